@@ -0,0 +1,34 @@
+#define TTL_ENABLE_BENCH
+#include <ttl.hpp>
+
+#ifdef __GLIBC__
+extern "C" {
+void *__libc_malloc(size_t);
+void *__libc_calloc(size_t, size_t);
+void *__libc_realloc(void *, size_t);
+
+void *
+malloc(size_t size) noexcept {
+  ::ttl::test::Allocations::record(size);
+  return __libc_malloc(size);
+}
+
+void *
+calloc(size_t n, size_t size) noexcept {
+  ::ttl::test::Allocations::record(n * size);
+  return __libc_calloc(n, size);
+}
+
+void *
+realloc(void *ptr, size_t size) noexcept {
+  ::ttl::test::Allocations::record(size);
+  return __libc_realloc(ptr, size);
+}
+}
+#endif
+
+int
+main(int argc, char *argv[]) {
+  if (!::ttl::test::run_benchmarks(argc, argv))
+    return 1;
+}
@@ -3,15 +3,51 @@
 #include <cstdlib>
 #include <cstdint>
 #include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+#include <chrono>
+#include <functional>
 #include <new>
 #include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
 #include <type_traits>
 #include <utility>
 
-#ifdef TTL_ENABLE_TEST
-#include <cstdio>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#endif
+
+namespace ttl {
+#include <ttl/profile/counters.hpp>
+}
+
+#if defined(TTL_ENABLE_TEST) || defined(TTL_ENABLE_BENCH)
 #include <cxxabi.h>
 #include <exception>
+#include <fnmatch.h>
+#include <sys/wait.h>
+
+#ifdef TTL_ENABLE_BENCH
+#include <vector>
+#include <deque>
+#include <forward_list>
+#include <list>
+#include <unordered_map>
+#endif
 
 namespace ttl {
 #include <ttl/test/test.hpp>
@@ -19,11 +55,26 @@ namespace ttl {
 #endif
 
 namespace ttl {
+#include <ttl/check.hpp>
 #include <ttl/format.hpp>
 #include <ttl/traits.hpp>
 
+#ifdef TTL_ENABLE_TEST
 #include <ttl/test.hpp>
+#endif
+#if defined(TTL_ENABLE_TEST) || defined(TTL_ENABLE_BENCH)
+#include <ttl/test/bench.hpp>
+#endif
+#ifdef TTL_ENABLE_BENCH
+#include <ttl/test/compare.hpp>
+#endif
 
 #include <ttl/storage.hpp>
 #include <ttl/collections.hpp>
+#include <ttl/algorithms.hpp>
+#include <ttl/reclaim.hpp>
+#include <ttl/format/engine.hpp>
+#include <ttl/logging.hpp>
+#include <ttl/serialize.hpp>
+#include <ttl/profile.hpp>
 }
@@ -0,0 +1,2 @@
+#include <ttl/algorithms/sort.hpp>
+#include <ttl/algorithms/scan.hpp>
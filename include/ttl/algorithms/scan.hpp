@@ -0,0 +1,439 @@
+namespace algorithms {
+  namespace scan {
+    using ::ttl::traits::Collection;
+    using ::ttl::traits::Contiguous;
+
+    enum class Isa { SCALAR, SSE42, AVX2, AVX512 };
+
+    template <typename T> struct Kernels {
+      ::std::size_t (*find)(T const *data, ::std::size_t n, T value);
+      ::std::size_t (*count)(T const *data, ::std::size_t n, T value);
+      void (*minmax)(T const *data, ::std::size_t n, T &min, T &max);
+    };
+
+    namespace scalar {
+      template <typename T>
+      ::std::size_t
+      find(T const *data, ::std::size_t n, T value) {
+        for (::std::size_t i = 0; i < n; ++i)
+          if (data[i] == value)
+            return i;
+        return n;
+      }
+
+      template <typename T>
+      ::std::size_t
+      count(T const *data, ::std::size_t n, T value) {
+        ::std::size_t result = 0;
+        for (::std::size_t i = 0; i < n; ++i)
+          result += (data[i] == value);
+        return result;
+      }
+
+      template <typename T>
+      void
+      minmax(T const *data, ::std::size_t n, T &min, T &max) {
+        for (::std::size_t i = 0; i < n; ++i) {
+          if (data[i] < min)
+            min = data[i];
+          if (max < data[i])
+            max = data[i];
+        }
+      }
+    }
+
+    namespace vector {
+      template <typename T, ::std::size_t W> struct Lanes {
+        typedef T Vector __attribute__((vector_size(W)));
+        typedef ::std::uint64_t Words __attribute__((vector_size(W)));
+        using Mask = decltype(Vector() == Vector());
+
+        static constexpr ::std::size_t N = W / sizeof(T);
+        static constexpr ::std::size_t FLUSH = (sizeof(T) == 1) ? 127 : 32767;
+      };
+
+      template <::std::size_t W, typename T>
+      __attribute__((always_inline)) inline ::std::size_t
+      find(T const *data, ::std::size_t n, T value) {
+        using L = Lanes<T, W>;
+        typename L::Vector needle = typename L::Vector{} + value;
+        ::std::size_t i = 0;
+
+        for (; i + L::N <= n; i += L::N) {
+          typename L::Vector v;
+          __builtin_memcpy(&v, data + i, W);
+          typename L::Words hits = (typename L::Words)(v == needle);
+          ::std::uint64_t any = 0;
+          for (::std::size_t k = 0; k < W / 8; ++k)
+            any |= hits[k];
+          if (any != 0)
+            break;
+        }
+
+        return i + scalar::find(data + i, n - i, value);
+      }
+
+      template <::std::size_t W, typename T>
+      __attribute__((always_inline)) inline ::std::size_t
+      count(T const *data, ::std::size_t n, T value) {
+        using L = Lanes<T, W>;
+        typename L::Vector needle = typename L::Vector{} + value;
+        ::std::size_t result = 0;
+        ::std::size_t i = 0;
+
+        while (i + L::N <= n) {
+          typename L::Mask hits = {};
+          for (::std::size_t b = 0; b < L::FLUSH && i + L::N <= n;
+               ++b, i += L::N) {
+            typename L::Vector v;
+            __builtin_memcpy(&v, data + i, W);
+            hits -= (v == needle);
+          }
+          for (::std::size_t k = 0; k < L::N; ++k)
+            result += hits[k];
+        }
+
+        return result + scalar::count(data + i, n - i, value);
+      }
+
+      template <::std::size_t W, typename T>
+      __attribute__((always_inline)) inline void
+      minmax(T const *data, ::std::size_t n, T &min, T &max) {
+        using L = Lanes<T, W>;
+        typename L::Vector vmin = typename L::Vector{} + min;
+        typename L::Vector vmax = typename L::Vector{} + max;
+        ::std::size_t i = 0;
+
+        for (; i + L::N <= n; i += L::N) {
+          typename L::Vector v;
+          __builtin_memcpy(&v, data + i, W);
+          vmin = (v < vmin) ? v : vmin;
+          vmax = (vmax < v) ? v : vmax;
+        }
+
+        for (::std::size_t k = 0; k < L::N; ++k) {
+          if (vmin[k] < min)
+            min = vmin[k];
+          if (max < vmax[k])
+            max = vmax[k];
+        }
+
+        scalar::minmax(data + i, n - i, min, max);
+      }
+    }
+
+#if defined(__x86_64__) || defined(__i386__)
+#define _TTL_SCAN_TARGET(isa, features, width)                                 \
+  template <typename T>                                                        \
+  __attribute__((target(features)))::std::size_t find_##isa(                   \
+      T const *data, ::std::size_t n, T value) {                               \
+    return vector::find<width>(data, n, value);                                \
+  }                                                                            \
+                                                                               \
+  template <typename T>                                                        \
+  __attribute__((target(features)))::std::size_t count_##isa(                  \
+      T const *data, ::std::size_t n, T value) {                               \
+    return vector::count<width>(data, n, value);                               \
+  }                                                                            \
+                                                                               \
+  template <typename T>                                                        \
+  __attribute__((target(features))) void minmax_##isa(                         \
+      T const *data, ::std::size_t n, T &min, T &max) {                        \
+    vector::minmax<width>(data, n, min, max);                                  \
+  }
+
+    _TTL_SCAN_TARGET(sse42, "sse4.2", 16)
+    _TTL_SCAN_TARGET(avx2, "avx2", 32)
+    _TTL_SCAN_TARGET(avx512, "avx512f,avx512bw", 64)
+
+#undef _TTL_SCAN_TARGET
+#endif
+
+    inline bool
+    supports(Isa isa) {
+#if defined(__x86_64__) || defined(__i386__)
+      __builtin_cpu_init();
+      switch (isa) {
+      case Isa::SCALAR:
+        return true;
+      case Isa::SSE42:
+        return __builtin_cpu_supports("sse4.2");
+      case Isa::AVX2:
+        return __builtin_cpu_supports("avx2");
+      case Isa::AVX512:
+        return __builtin_cpu_supports("avx512f") &&
+               __builtin_cpu_supports("avx512bw");
+      }
+      return false;
+#else
+      return isa == Isa::SCALAR;
+#endif
+    }
+
+    template <typename T>
+    Kernels<T>
+    kernels(Isa isa) {
+      CHECK(supports(isa));
+
+      switch (isa) {
+#if defined(__x86_64__) || defined(__i386__)
+      case Isa::SSE42:
+        return {find_sse42<T>, count_sse42<T>, minmax_sse42<T>};
+      case Isa::AVX2:
+        return {find_avx2<T>, count_avx2<T>, minmax_avx2<T>};
+      case Isa::AVX512:
+        return {find_avx512<T>, count_avx512<T>, minmax_avx512<T>};
+#endif
+      default:
+        return {scalar::find<T>, scalar::count<T>, scalar::minmax<T>};
+      }
+    }
+
+    inline Isa
+    best() {
+      static Isa const isa = supports(Isa::AVX512)
+                                 ? Isa::AVX512
+                                 : supports(Isa::AVX2)
+                                       ? Isa::AVX2
+                                       : supports(Isa::SSE42) ? Isa::SSE42
+                                                              : Isa::SCALAR;
+      return isa;
+    }
+
+    template <typename T>
+    Kernels<T> const &
+    kernels() {
+      static Kernels<T> const k = kernels<T>(best());
+      return k;
+    }
+
+    template <typename L>
+    ::std::size_t
+    find(L &list, typename Contiguous::Impl<L>::Item value) {
+      using T = typename Contiguous::Impl<L>::Item;
+      return kernels<T>().find(Contiguous::data(list), Collection::size(list),
+                               value);
+    }
+
+    template <typename L>
+    ::std::size_t
+    count(L &list, typename Contiguous::Impl<L>::Item value) {
+      using T = typename Contiguous::Impl<L>::Item;
+      return kernels<T>().count(Contiguous::data(list),
+                                Collection::size(list), value);
+    }
+
+    template <typename L>
+    ::std::pair<typename Contiguous::Impl<L>::Item,
+                typename Contiguous::Impl<L>::Item>
+    minmax(L &list) {
+      using T = typename Contiguous::Impl<L>::Item;
+      ::std::size_t n = Collection::size(list);
+      CHECK(n > 0);
+
+      T const *data = Contiguous::data(list);
+      T min = data[0], max = data[0];
+      kernels<T>().minmax(data, n, min, max);
+      return {min, max};
+    }
+  }
+
+  using scan::find;
+  using scan::count;
+  using scan::minmax;
+}
+
+#ifdef TTL_ENABLE_TEST
+namespace algorithms {
+  namespace scan {
+    namespace {
+      using ::ttl::test::AssertionFailure;
+      using ::ttl::test::Random;
+      using ::ttl::traits::Stack;
+      using ::ttl::collections::Array;
+
+      template <typename T>
+      void
+      test_kernels(Random &random, ::std::uint64_t range) {
+        Isa const isas[] = {Isa::SCALAR, Isa::SSE42, Isa::AVX2, Isa::AVX512};
+        T data[300];
+
+        for (::std::size_t n = 1; n <= 300; n += 7) {
+          for (::std::size_t i = 0; i < n; ++i)
+            data[i] = T(random.next() % range) - T(range / 2);
+          T value = data[random.next() % n];
+          T absent = T(range);
+
+          ::std::size_t find = scalar::find(data, n, value);
+          ::std::size_t count = scalar::count(data, n, value);
+          T min = data[0], max = data[0];
+          scalar::minmax(data, n, min, max);
+
+          for (Isa isa : isas) {
+            if (not supports(isa))
+              continue;
+
+            Kernels<T> k = kernels<T>(isa);
+            ASSERT(k.find(data, n, value) == find);
+            ASSERT(k.find(data, n, absent) == n);
+            ASSERT(k.count(data, n, value) == count);
+            ASSERT(k.count(data, n, absent) == 0);
+
+            T kmin = data[0], kmax = data[0];
+            k.minmax(data, n, kmin, kmax);
+            ASSERT(kmin == min);
+            ASSERT(kmax == max);
+          }
+        }
+      }
+
+      TESTCASE("test scan kernels") {
+        Random random;
+
+        SECTION("equivalence") {
+          test_kernels<::std::int8_t>(random, 100);
+          test_kernels<::std::uint8_t>(random, 100);
+          test_kernels<::std::int16_t>(random, 1000);
+          test_kernels<::std::int32_t>(random, 1000);
+          test_kernels<::std::uint32_t>(random, 1000);
+          test_kernels<::std::int64_t>(random, 1000000);
+          test_kernels<float>(random, 1000);
+          test_kernels<double>(random, 1000000);
+        }
+
+        SECTION("count overflow") {
+          ::std::uint8_t data[10000];
+          for (::std::uint8_t &x : data)
+            x = 1;
+          for (Isa isa : {Isa::SSE42, Isa::AVX2, Isa::AVX512})
+            if (supports(isa))
+              ASSERT(kernels<::std::uint8_t>(isa).count(data, 10000, 1) ==
+                     10000);
+        }
+
+        SECTION("array") {
+          Array<::std::int32_t> a(1000);
+          for (::std::int32_t i = 0; i < 1000; ++i)
+            Stack::push(a, i % 100 - 50);
+
+          ASSERT(find(a, 7) == 57);
+          ASSERT(find(a, 1000) == 1000);
+          ASSERT(count(a, -50) == 10);
+          ASSERT(minmax(a).first == -50);
+          ASSERT(minmax(a).second == 49);
+
+          Stack::clear(a);
+          ASSERT_THROW(AssertionFailure, minmax(a));
+        }
+      }
+    }
+  }
+}
+#endif
+
+#ifdef TTL_ENABLE_BENCH
+namespace algorithms {
+  namespace scan {
+    namespace {
+      using ::ttl::test::Bench;
+      using ::ttl::test::Random;
+      using ::ttl::test::do_not_optimize;
+      using ::ttl::traits::List;
+      using ::ttl::traits::Stack;
+      using ::ttl::collections::Array;
+
+      template <typename T>
+      Array<T>
+      make_array(::std::size_t n) {
+        Array<T> a(n);
+        Random random;
+        for (::std::size_t i = 0; i < n; ++i)
+          Stack::push(a, T(random.next() % 1000));
+        return a;
+      }
+
+      template <typename T>
+      void
+      bench_get_count(Bench &bench) {
+        Array<T> a = make_array<T>(bench.arg);
+        bench.ops = bench.arg;
+
+        for (::std::size_t i : bench) {
+          ::std::size_t result = 0;
+          for (::std::size_t j = 0; j < bench.arg; ++j)
+            result += (List::get(a, j) == T(i % 1000));
+          do_not_optimize(result);
+        }
+      }
+
+      template <typename T>
+      void
+      bench_count(Bench &bench, Isa isa) {
+        Array<T> a = make_array<T>(bench.arg);
+        Kernels<T> k = kernels<T>(isa);
+        bench.ops = bench.arg;
+
+        for (::std::size_t i : bench)
+          do_not_optimize(k.count(Contiguous::data(a), a.size, T(i % 1000)));
+      }
+
+      template <typename T>
+      void
+      bench_minmax(Bench &bench, Isa isa) {
+        Array<T> a = make_array<T>(bench.arg);
+        Kernels<T> k = kernels<T>(isa);
+        bench.ops = bench.arg;
+
+        for (::std::size_t i : bench) {
+          T min = T(i), max = T(i);
+          k.minmax(Contiguous::data(a), a.size, min, max);
+          do_not_optimize(min);
+          do_not_optimize(max);
+        }
+      }
+
+      BENCHMARK_RANGE("scan/count/int32/get", 1000, 10000000) {
+        bench_get_count<::std::int32_t>(bench);
+      }
+
+      BENCHMARK_RANGE("scan/count/int32/scalar", 1000, 10000000) {
+        bench_count<::std::int32_t>(bench, Isa::SCALAR);
+      }
+
+      BENCHMARK_RANGE_IF("scan/count/int32/sse4.2", 1000, 10000000,
+                         supports(Isa::SSE42)) {
+        bench_count<::std::int32_t>(bench, Isa::SSE42);
+      }
+
+      BENCHMARK_RANGE_IF("scan/count/int32/avx2", 1000, 10000000,
+                         supports(Isa::AVX2)) {
+        bench_count<::std::int32_t>(bench, Isa::AVX2);
+      }
+
+      BENCHMARK_RANGE_IF("scan/count/int32/avx512", 1000, 10000000,
+                         supports(Isa::AVX512)) {
+        bench_count<::std::int32_t>(bench, Isa::AVX512);
+      }
+
+      BENCHMARK_RANGE("scan/minmax/float/scalar", 1000, 10000000) {
+        bench_minmax<float>(bench, Isa::SCALAR);
+      }
+
+      BENCHMARK_RANGE_IF("scan/minmax/float/sse4.2", 1000, 10000000,
+                         supports(Isa::SSE42)) {
+        bench_minmax<float>(bench, Isa::SSE42);
+      }
+
+      BENCHMARK_RANGE_IF("scan/minmax/float/avx2", 1000, 10000000,
+                         supports(Isa::AVX2)) {
+        bench_minmax<float>(bench, Isa::AVX2);
+      }
+
+      BENCHMARK_RANGE_IF("scan/minmax/float/avx512", 1000, 10000000,
+                         supports(Isa::AVX512)) {
+        bench_minmax<float>(bench, Isa::AVX512);
+      }
+    }
+  }
+}
+#endif
@@ -0,0 +1,276 @@
+namespace algorithms {
+  namespace sort {
+    using ::ttl::traits::Collection;
+    using ::ttl::traits::Contiguous;
+    using ::ttl::storage::Chunk;
+
+    static constexpr ::std::size_t RADIX_BITS = 8;
+    static constexpr ::std::size_t RADIX = 1u << RADIX_BITS;
+    static constexpr ::std::size_t SMALL_SORT = 256;
+
+    struct Identity {
+      template <typename T>
+      T
+      operator()(T const &item) const {
+        return item;
+      }
+    };
+
+    template <typename K>
+    auto
+    radix_key(K key) -> typename ::std::enable_if<
+        ::std::is_integral<K>::value,
+        typename ::std::make_unsigned<K>::type>::type {
+      using U = typename ::std::make_unsigned<K>::type;
+      constexpr U SIGN = ::std::is_signed<K>::value
+                             ? U(U(1) << (sizeof(U) * 8 - 1))
+                             : U(0);
+      return U(key) ^ SIGN;
+    }
+
+    template <typename T, typename F>
+    using RadixKey =
+        decltype(radix_key(::std::declval<F &>()(::std::declval<T const &>())));
+
+    template <typename T, typename F>
+    ::std::size_t
+    radix_sort_n(T *data, T *scratch, ::std::size_t n, F &key) {
+      using U = RadixKey<T, F>;
+      constexpr ::std::size_t DIGITS = sizeof(U) * 8 / RADIX_BITS;
+
+      if (n == 0)
+        return 0;
+
+      ::std::size_t counts[DIGITS][RADIX] = {};
+      for (::std::size_t i = 0; i < n; ++i) {
+        U k = radix_key(key(data[i]));
+        for (::std::size_t d = 0; d < DIGITS; ++d)
+          counts[d][(k >> (d * RADIX_BITS)) & (RADIX - 1)] += 1;
+      }
+
+      U first = radix_key(key(data[0]));
+      T *from = data;
+      T *to = scratch;
+      ::std::size_t passes = 0;
+
+      for (::std::size_t d = 0; d < DIGITS; ++d) {
+        ::std::size_t shift = d * RADIX_BITS;
+        ::std::size_t *count = counts[d];
+        if (count[(first >> shift) & (RADIX - 1)] == n)
+          continue;
+
+        ::std::size_t offset = 0;
+        for (::std::size_t b = 0; b < RADIX; ++b) {
+          ::std::size_t c = count[b];
+          count[b] = offset;
+          offset += c;
+        }
+
+        for (::std::size_t i = 0; i < n; ++i)
+          to[count[(radix_key(key(from[i])) >> shift) & (RADIX - 1)]++] =
+              from[i];
+
+        ::std::swap(from, to);
+        passes += 1;
+      }
+
+      if (from != data)
+        ::std::copy(from, from + n, data);
+      return passes;
+    }
+
+    template <typename T, typename F>
+    void
+    insertion_sort_n(T *data, ::std::size_t n, F &key) {
+      for (::std::size_t i = 1; i < n; ++i) {
+        T item = data[i];
+        auto k = radix_key(key(item));
+        ::std::size_t j = i;
+        for (; (j > 0) && (k < radix_key(key(data[j - 1]))); --j)
+          data[j] = data[j - 1];
+        data[j] = item;
+      }
+    }
+
+    template <typename L, typename F = Identity>
+    auto
+    radix_sort(L &list, Chunk<typename Contiguous::Impl<L>::Item> &scratch,
+               F key = {})
+        -> ::std::void_t<RadixKey<typename Contiguous::Impl<L>::Item, F>> {
+      using T = typename Contiguous::Impl<L>::Item;
+      static_assert(::std::is_trivially_copyable<T>::value,
+                    "radix sort moves items with plain copies");
+
+      ::std::size_t n = Collection::size(list);
+      T *data = Contiguous::data(list);
+
+      if (n < SMALL_SORT) {
+        insertion_sort_n(data, n, key);
+        return;
+      }
+
+      if (scratch.capacity < n)
+        scratch.resize(n);
+      radix_sort_n(data, scratch.data, n, key);
+    }
+
+    template <typename L, typename F = Identity>
+    auto
+    radix_sort(L &list, F key = {})
+        -> ::std::void_t<RadixKey<typename Contiguous::Impl<L>::Item, F>> {
+      Chunk<typename Contiguous::Impl<L>::Item> scratch(0);
+      radix_sort(list, scratch, key);
+    }
+  }
+
+  using sort::radix_sort;
+}
+
+#ifdef TTL_ENABLE_TEST
+namespace algorithms {
+  namespace sort {
+    namespace {
+      using ::ttl::test::Random;
+      using ::ttl::traits::List;
+      using ::ttl::traits::Stack;
+      using ::ttl::collections::Array;
+
+      struct Record {
+        ::std::uint32_t key;
+        ::std::uint32_t index;
+      };
+
+      template <typename T>
+      bool
+      is_sorted(Array<T> const &a) {
+        for (::std::size_t i = 1; i < a.size; ++i)
+          if (List::get(a, i) < List::get(a, i - 1))
+            return false;
+        return true;
+      }
+
+      TESTCASE("test radix sort") {
+        Random random;
+
+        SECTION("unsigned") {
+          for (::std::size_t n : {0, 1, 100, 255, 256, 10000}) {
+            Array<::std::uint64_t> a(n);
+            for (::std::size_t i = 0; i < n; ++i)
+              Stack::push(a, random.next());
+            radix_sort(a);
+            ASSERT(a.size == n);
+            ASSERT(is_sorted(a));
+          }
+        }
+
+        SECTION("signed") {
+          Array<::std::int32_t> a(10000);
+          for (::std::size_t i = 0; i < 10000; ++i)
+            Stack::push(a, ::std::int32_t(random.next()));
+          radix_sort(a);
+          ASSERT(List::get(a, 0) < 0);
+          ASSERT(is_sorted(a));
+        }
+
+        SECTION("constant digits") {
+          ::std::uint32_t data[1000], scratch[1000];
+          Identity key;
+          for (::std::size_t i = 0; i < 1000; ++i)
+            data[i] = 0x12003400 | ::std::uint32_t(random.next() & 0xff00ff);
+          ASSERT(radix_sort_n(data, scratch, 1000, key) == 2);
+          ASSERT(::std::is_sorted(data, data + 1000));
+
+          for (::std::size_t i = 0; i < 1000; ++i)
+            data[i] = 7;
+          ASSERT(radix_sort_n(data, scratch, 1000, key) == 0);
+        }
+
+        SECTION("records") {
+          for (::std::uint32_t n : {100u, 10000u}) {
+            Array<Record> a(n);
+            Chunk<Record> scratch(0);
+            for (::std::uint32_t i = 0; i < n; ++i)
+              Stack::push(a, {::std::uint32_t(random.next() % 10), i});
+
+            radix_sort(a, scratch, [](Record const &r) { return r.key; });
+            ASSERT(scratch.capacity >= ((n < SMALL_SORT) ? 0 : n));
+            for (::std::size_t i = 1; i < a.size; ++i) {
+              Record const &prev = List::get(a, i - 1);
+              Record const &next = List::get(a, i);
+              ASSERT(prev.key <= next.key);
+              ASSERT((prev.key < next.key) || (prev.index < next.index));
+            }
+          }
+        }
+      }
+    }
+  }
+}
+#endif
+
+#ifdef TTL_ENABLE_BENCH
+namespace algorithms {
+  namespace sort {
+    namespace {
+      using ::ttl::test::Bench;
+      using ::ttl::test::Random;
+      using ::ttl::test::do_not_optimize;
+      using ::ttl::traits::List;
+      using ::ttl::traits::Stack;
+      using ::ttl::collections::Array;
+
+      template <typename T, typename S>
+      void
+      bench_sort(Bench &bench, S sort) {
+        Array<T> a(bench.arg);
+        for (::std::size_t j = 0; j < bench.arg; ++j)
+          Stack::push(a, T(0));
+
+        Random random;
+        bench.ops = bench.arg;
+
+        for (::std::size_t i : bench) {
+          T *data = Contiguous::data(a);
+          for (::std::size_t j = 0; j < bench.arg; ++j)
+            data[j] = T(random.next());
+          sort(a);
+          do_not_optimize(List::get(a, i % bench.arg));
+        }
+      }
+
+      template <typename T>
+      void
+      bench_radix_sort(Bench &bench) {
+        Chunk<T> scratch(0);
+        bench_sort<T>(bench, [&scratch](Array<T> &a) {
+          radix_sort(a, scratch);
+        });
+      }
+
+      template <typename T>
+      void
+      bench_std_sort(Bench &bench) {
+        bench_sort<T>(bench, [](Array<T> &a) {
+          ::std::sort(Contiguous::data(a), Contiguous::data(a) + a.size);
+        });
+      }
+
+      BENCHMARK_RANGE("radix_sort/uint32", 1000, 1000000000) {
+        bench_radix_sort<::std::uint32_t>(bench);
+      }
+
+      BENCHMARK_RANGE("radix_sort/uint64", 1000, 1000000000) {
+        bench_radix_sort<::std::uint64_t>(bench);
+      }
+
+      BENCHMARK_RANGE("std::sort/uint32", 1000, 1000000000) {
+        bench_std_sort<::std::uint32_t>(bench);
+      }
+
+      BENCHMARK_RANGE("std::sort/uint64", 1000, 1000000000) {
+        bench_std_sort<::std::uint64_t>(bench);
+      }
+    }
+  }
+}
+#endif
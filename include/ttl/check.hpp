@@ -0,0 +1,49 @@
+#ifndef TTL_CHECK_LEVEL
+#if defined(TTL_ENABLE_TEST)
+#define TTL_CHECK_LEVEL 2
+#elif defined(NDEBUG)
+#define TTL_CHECK_LEVEL 0
+#else
+#define TTL_CHECK_LEVEL 1
+#endif
+#endif
+
+#if defined(TTL_ENABLE_TEST) && (TTL_CHECK_LEVEL < 1)
+#error "tests expect failed checks to throw, TTL_CHECK_LEVEL must be >= 1"
+#endif
+
+namespace check {
+  [[noreturn]] __attribute__((cold, noinline)) inline void
+  fail(const char *file, int line, const char *expr) {
+#if defined(TTL_ENABLE_TEST) || defined(TTL_ENABLE_BENCH)
+    throw ::ttl::test::AssertionFailure("%s:%d: CHECK FAILED\n  %s\n", file,
+                                        line, expr);
+#else
+    ::std::fprintf(stderr, "%s:%d: CHECK FAILED\n  %s\n", file, line, expr);
+    ::std::abort();
+#endif
+  }
+}
+
+#define _TTL_CHECK_FAIL(...)                                                   \
+  (__builtin_expect(!!(__VA_ARGS__), 1)                                        \
+       ? (void)0                                                               \
+       : ::ttl::check::fail(__FILE__, __LINE__, #__VA_ARGS__))
+
+#ifdef TTL_CHECK_ASSUME
+#define _TTL_CHECK_OFF(...) ((__VA_ARGS__) ? (void)0 : __builtin_unreachable())
+#else
+#define _TTL_CHECK_OFF(...) ((void)0)
+#endif
+
+#if TTL_CHECK_LEVEL >= 1
+#define CHECK(...) _TTL_CHECK_FAIL(__VA_ARGS__)
+#else
+#define CHECK(...) _TTL_CHECK_OFF(__VA_ARGS__)
+#endif
+
+#if TTL_CHECK_LEVEL >= 2
+#define CHECK_FULL(...) _TTL_CHECK_FAIL(__VA_ARGS__)
+#else
+#define CHECK_FULL(...) _TTL_CHECK_OFF(__VA_ARGS__)
+#endif
@@ -1,3 +1,10 @@
 #include <ttl/collections/capacity.hpp>
 #include <ttl/collections/array.hpp>
+#include <ttl/collections/segarray.hpp>
+#include <ttl/collections/cvector.hpp>
 #include <ttl/collections/flist.hpp>
+#include <ttl/collections/iflist.hpp>
+#include <ttl/collections/pstack.hpp>
+#include <ttl/collections/marray.hpp>
+#include <ttl/collections/slotmap.hpp>
+#include <ttl/collections/lru.hpp>
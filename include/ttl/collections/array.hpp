@@ -3,31 +3,74 @@ namespace collections {
   namespace array {
     using ::ttl::traits::IMPLEMENTS;
     using ::ttl::traits::CapacityPolicy;
+    using ::ttl::traits::ResizingPolicy;
     using ::ttl::storage::Chunk;
+    using ::ttl::storage::NoInstrumentation;
     using ::ttl::traits::Stack;
 
-    template <typename T, typename P = DefaultResizingPolicy, typename = void>
+    template <typename T, typename P = DefaultResizingPolicy,
+              typename I = NoInstrumentation, typename = void>
     struct Array;
 
-    template <typename T, typename P>
-    struct Array<T, P, IMPLEMENTS<P, CapacityPolicy>> {
+    template <typename T, typename P, typename I>
+    struct Array<T, P, I, IMPLEMENTS<P, CapacityPolicy>> {
       ::std::size_t size;
-      Chunk<T> data;
+      Chunk<T, I> data;
+      P policy;
 
-      Array(::std::size_t capacity)
+      Array(::std::size_t capacity, P &&policy = {})
           : size(0)
-          , data(CapacityPolicy::initial<P>(capacity)) {
+          , data(CapacityPolicy::initial<P>(capacity))
+          , policy(::std::move(policy)) {
       }
 
-      Array(Array &&o) noexcept : size(0), data(::std::move(o.data)) {
+      Array(Array &&o) noexcept : size(0),
+                                  data(::std::move(o.data)),
+                                  policy(::std::move(o.policy)) {
         ::std::swap(size, o.size);
       }
 
       ~Array() {
-        while (!Stack::is_empty(*this))
-          Stack::pop(*this);
+        data.destroy_n(size);
       }
     };
+
+    template <typename A>
+    auto
+    fit(A &self, int)
+        -> decltype(ResizingPolicy::fit(self.policy, 0, 0), void()) {
+      self.data.capacity = ResizingPolicy::fit(
+          self.policy, self.data.capacity, self.data.usable());
+    }
+
+    template <typename A>
+    void
+    fit(A &, long) {
+    }
+
+    template <typename A>
+    void
+    resize(A &self, ::std::size_t capacity) {
+      self.data.resize(capacity);
+      fit(self, 0);
+    }
+
+    template <typename A>
+    void
+    shrink(A &self) {
+      ::std::size_t capacity = self.data.capacity;
+      ::std::size_t new_capacity =
+          ResizingPolicy::shrink(self.policy, self.size, capacity);
+
+      if (new_capacity < capacity)
+        resize(self, new_capacity);
+    }
+
+    template <typename T, typename P, typename I>
+    ::std::size_t
+    trim(Array<T, P, I> &self) {
+      return self.data.purge(self.size);
+    }
   }
 
   using array::Array;
@@ -35,10 +78,10 @@ namespace collections {
 
 namespace traits {
 
-  template <typename T, typename P>
-  struct Collection::Impl<::ttl::collections::Array<T, P>, void> {
+  template <typename T, typename P, typename I>
+  struct Collection::Impl<::ttl::collections::Array<T, P, I>, void> {
   private:
-    using Array = ::ttl::collections::Array<T, P>;
+    using Array = ::ttl::collections::Array<T, P, I>;
 
   public:
     static ::std::size_t
@@ -47,12 +90,13 @@ namespace traits {
     }
   };
 
-  template <typename T>
+  template <typename T, typename I>
   struct Bounded::Impl<
-      ::ttl::collections::Array<T, ::ttl::collections::FixedCapacity>, void> {
+      ::ttl::collections::Array<T, ::ttl::collections::FixedCapacity, I>,
+      void> {
   private:
     using Array =
-        ::ttl::collections::Array<T, ::ttl::collections::FixedCapacity>;
+        ::ttl::collections::Array<T, ::ttl::collections::FixedCapacity, I>;
 
   public:
     static ::std::size_t
@@ -61,11 +105,11 @@ namespace traits {
     }
   };
 
-  template <typename T, typename P>
-  struct Unbounded::Impl<::ttl::collections::Array<T, P>,
+  template <typename T, typename P, typename I>
+  struct Unbounded::Impl<::ttl::collections::Array<T, P, I>,
                          IMPLEMENTS<P, ResizingPolicy>> {
   private:
-    using Array = ::ttl::collections::Array<T, P>;
+    using Array = ::ttl::collections::Array<T, P, I>;
 
   public:
     static ::std::size_t
@@ -76,7 +120,7 @@ namespace traits {
     static void
     reserve(Array &self, ::std::size_t capacity) {
       if (capacity > self.data.capacity)
-        self.data.resize(capacity);
+        ::ttl::collections::array::resize(self, capacity);
     }
 
     static void
@@ -87,42 +131,57 @@ namespace traits {
     }
   };
 
-  template <typename T, typename P>
-  struct List::Impl<::ttl::collections::Array<T, P>, void> {
+  template <typename T, typename P, typename I>
+  struct List::Impl<::ttl::collections::Array<T, P, I>, void> {
   private:
-    using Array = ::ttl::collections::Array<T, P>;
+    using Array = ::ttl::collections::Array<T, P, I>;
 
   public:
     using Item = T;
 
     static T const &
     get(Array const &self, ::std::size_t index) {
-      ASSERT(index < self.size);
+      CHECK(index < self.size);
       return self.data.get(index);
     }
   };
 
-  template <typename T, typename P>
-  struct ListMut::Impl<::ttl::collections::Array<T, P>, void> {
+  template <typename T, typename P, typename I>
+  struct ListMut::Impl<::ttl::collections::Array<T, P, I>, void> {
   private:
-    using Array = ::ttl::collections::Array<T, P>;
+    using Array = ::ttl::collections::Array<T, P, I>;
 
   public:
     using Item = T;
 
     static T &
     get(Array &self, ::std::size_t index) {
-      ASSERT(index < self.size);
+      CHECK(index < self.size);
       return self.data.get(index);
     }
   };
 
-  template <typename T>
+  template <typename T, typename P, typename I>
+  struct Contiguous::Impl<::ttl::collections::Array<T, P, I>, void> {
+  private:
+    using Array = ::ttl::collections::Array<T, P, I>;
+
+  public:
+    using Item = T;
+
+    static T *
+    data(Array &self) {
+      return self.data.data;
+    }
+  };
+
+  template <typename T, typename I>
   struct Stack::Impl<
-      ::ttl::collections::Array<T, ::ttl::collections::FixedCapacity>, void> {
+      ::ttl::collections::Array<T, ::ttl::collections::FixedCapacity, I>,
+      void> {
   private:
     using Array =
-        ::ttl::collections::Array<T, ::ttl::collections::FixedCapacity>;
+        ::ttl::collections::Array<T, ::ttl::collections::FixedCapacity, I>;
 
   public:
     using Item = T;
@@ -132,24 +191,49 @@ namespace traits {
       return self.size == 0;
     }
 
+    template <typename... Args>
+    static void
+    emplace(Array &self, Args &&... args) {
+      CHECK(self.size < self.data.capacity);
+      self.data.emplace(self.size++, ::std::forward<Args>(args)...);
+    }
+
     static void
     push(Array &self, T &&item) {
-      ASSERT(self.size < self.data.capacity);
-      self.data.write(self.size++, ::std::move(item));
+      emplace(self, ::std::move(item));
     }
 
     static T
     pop(Array &self) {
-      ASSERT(self.size > 0);
+      CHECK(self.size > 0);
       return self.data.read(--self.size);
     }
+
+    static void
+    pop_into(Array &self, T &item) {
+      CHECK(self.size > 0);
+      item = ::std::move(self.data.get(--self.size));
+      self.data.destroy(self.size);
+    }
+
+    static void
+    drop(Array &self) {
+      CHECK(self.size > 0);
+      self.data.destroy(--self.size);
+    }
+
+    static void
+    clear(Array &self) {
+      self.data.destroy_n(self.size);
+      self.size = 0;
+    }
   };
 
-  template <typename T, typename P>
-  struct Stack::Impl<::ttl::collections::Array<T, P>,
+  template <typename T, typename P, typename I>
+  struct Stack::Impl<::ttl::collections::Array<T, P, I>,
                      IMPLEMENTS<P, ResizingPolicy>> {
   private:
-    using Array = ::ttl::collections::Array<T, P>;
+    using Array = ::ttl::collections::Array<T, P, I>;
 
   public:
     using Item = T;
@@ -159,27 +243,52 @@ namespace traits {
       return self.size == 0;
     }
 
+    template <typename... Args>
     static void
-    push(Array &self, T &&item) {
+    emplace(Array &self, Args &&... args) {
       if (self.size == self.data.capacity)
-        self.data.resize(ResizingPolicy::grow<P>(self.size));
+        ::ttl::collections::array::resize(
+            self, ResizingPolicy::grow(self.policy, self.size));
+
+      self.data.emplace(self.size++, ::std::forward<Args>(args)...);
+    }
 
-      self.data.write(self.size++, ::std::move(item));
+    static void
+    push(Array &self, T &&item) {
+      emplace(self, ::std::move(item));
     }
 
     static T
     pop(Array &self) {
-      ASSERT(self.size > 0);
+      CHECK(self.size > 0);
 
       T item = self.data.read(--self.size);
-      ::std::size_t capacity = self.data.capacity;
-      ::std::size_t new_capacity =
-          ResizingPolicy::shrink<P>(self.size, capacity);
+      ::ttl::collections::array::shrink(self);
+      return item;
+    }
 
-      if (new_capacity < capacity)
-        self.data.resize(new_capacity);
+    static void
+    pop_into(Array &self, T &item) {
+      CHECK(self.size > 0);
 
-      return item;
+      item = ::std::move(self.data.get(--self.size));
+      self.data.destroy(self.size);
+      ::ttl::collections::array::shrink(self);
+    }
+
+    static void
+    drop(Array &self) {
+      CHECK(self.size > 0);
+
+      self.data.destroy(--self.size);
+      ::ttl::collections::array::shrink(self);
+    }
+
+    static void
+    clear(Array &self) {
+      self.data.destroy_n(self.size);
+      self.size = 0;
+      ::ttl::collections::array::shrink(self);
     }
   };
 }
@@ -190,13 +299,27 @@ namespace collections {
     namespace {
       using ::ttl::test::test_stack_destruction;
       using ::ttl::test::test_stack;
+      using ::ttl::test::test_stack_emplace;
+      using ::ttl::test::test_stack_pop_into;
+      using ::ttl::test::test_stack_clear;
       using ::ttl::test::test_bounded_stack_overflow;
       using ::ttl::test::test_unbounded_stack_grow;
       using ::ttl::test::test_unbounded_stack_shrink;
       using ::ttl::test::test_unbounded_reserve;
       using ::ttl::test::test_unbounded_shrink_to_fit;
+      using ::ttl::storage::ResizeCounter;
+      using ::ttl::traits::List;
+      using ::ttl::traits::Unbounded;
 
       template <typename T> using FixedArray = Array<T, FixedCapacity>;
+      template <typename T>
+      using DoublingArray = Array<T, DoublingResizingPolicy>;
+      template <typename T>
+      using UsableSizeArray = Array<T, UsableSizeResizingPolicy>;
+      template <typename T>
+      using GrowOnlyArray = Array<T, GrowOnlyResizingPolicy>;
+      template <typename T>
+      using HysteresisArray = Array<T, HysteresisResizingPolicy<4>>;
 
       TESTCASE("test array") {
 
@@ -219,10 +342,54 @@ namespace collections {
           }
         }
 
+        SECTION("emplace") {
+          SECTION("fixed") {
+            test_stack_emplace<FixedArray>({10});
+            test_stack_pop_into<FixedArray>({10});
+          }
+          SECTION("resizing") {
+            test_stack_emplace<Array>({10});
+            test_stack_pop_into<Array>({0});
+          }
+        }
+
+        SECTION("clear") {
+          SECTION("fixed") {
+            test_stack_clear<FixedArray>({10});
+          }
+          SECTION("resizing") {
+            test_stack_clear<Array>({10});
+
+            Array<::std::size_t, DefaultResizingPolicy, ResizeCounter> a(0);
+            for (::std::size_t i = 0; i < 100; i++)
+              Stack::push(a, ::std::move(i));
+
+            ::std::size_t resizes = a.data.stats.resizes;
+            Stack::clear(a);
+            ASSERT(a.data.stats.resizes == resizes + 1);
+            ASSERT(Unbounded::capacity(a) == 10);
+          }
+        }
+
         SECTION("bounded") {
           test_bounded_stack_overflow<FixedArray>({5});
         }
 
+        SECTION("trim") {
+          FixedArray<::std::size_t> a(1 << 20);
+          ASSERT(trim(a) > 0);
+          for (::std::size_t i = 0; i < (1 << 20); i++)
+            Stack::push(a, ::std::move(i));
+          for (::std::size_t i = 1000; i < (1 << 20); i++)
+            Stack::drop(a);
+
+          ASSERT(trim(a) >= 8 * ((1 << 20) - 1000) - 8192);
+          for (::std::size_t i = 1000; i < (1 << 20); i++)
+            Stack::push(a, ::std::move(i));
+          for (::std::size_t i = 0; i < (1 << 20); i++)
+            ASSERT(List::get(a, i) == i);
+        }
+
         SECTION("unbounded stack") {
           SECTION("grow") {
             test_unbounded_stack_grow<Array>({0});
@@ -248,6 +415,288 @@ namespace collections {
               ASSERT(Stack::pop(a) == 10 - i);
           }
         }
+
+        SECTION("instrumentation") {
+          Array<::std::size_t, DefaultResizingPolicy, ResizeCounter> a(0);
+
+          for (::std::size_t i = 0; i < 11; i++)
+            Stack::push(a, ::std::move(i));
+
+          ASSERT(a.data.stats.resizes == 1);
+          ASSERT(a.data.stats.grows == 1);
+
+          for (::std::size_t i = 0; i < 11; i++)
+            Stack::pop(a);
+
+          ASSERT(a.data.stats.shrinks == 1);
+          ASSERT(a.data.stats.resizes == 2);
+        }
+
+        SECTION("policies") {
+          SECTION("doubling") {
+            test_stack<DoublingArray>({0});
+
+            DoublingArray<::std::size_t> a(0);
+            ASSERT(Unbounded::capacity(a) == 8);
+            for (::std::size_t i = 0; i < 33; i++)
+              Stack::push(a, ::std::move(i));
+            ASSERT(Unbounded::capacity(a) == 64);
+            while (a.size > 16)
+              Stack::pop(a);
+            ASSERT(Unbounded::capacity(a) == 32);
+          }
+
+          SECTION("usable size") {
+            test_stack<UsableSizeArray>({0});
+
+            UsableSizeArray<::std::size_t> a(0);
+            for (::std::size_t i = 0; i < 11; i++)
+              Stack::push(a, ::std::move(i));
+            ASSERT(Unbounded::capacity(a) >= 15);
+            ASSERT(Unbounded::capacity(a) <= a.data.usable());
+          }
+
+          SECTION("grow only") {
+            test_stack<GrowOnlyArray>({0});
+
+            GrowOnlyArray<::std::size_t> a(0);
+            for (::std::size_t i = 0; i < 100; i++)
+              Stack::push(a, ::std::move(i));
+            ::std::size_t capacity = Unbounded::capacity(a);
+            for (::std::size_t i = 0; i < 100; i++)
+              Stack::pop(a);
+            ASSERT(Unbounded::capacity(a) == capacity);
+          }
+
+          SECTION("hysteresis") {
+            test_stack<HysteresisArray>({0});
+
+            Array<::std::size_t> d(0);
+            HysteresisArray<::std::size_t> a(0);
+            for (::std::size_t i = 0; i < 100; i++) {
+              Stack::push(d, ::std::size_t(i));
+              Stack::push(a, ::std::move(i));
+            }
+
+            ::std::size_t capacity = Unbounded::capacity(d);
+            ASSERT(Unbounded::capacity(a) == capacity);
+
+            while (Unbounded::capacity(d) == capacity)
+              Stack::pop(d);
+            while (Unbounded::capacity(a) == capacity)
+              Stack::pop(a);
+            ASSERT(a.size == d.size - 3);
+          }
+        }
+      }
+    }
+  }
+}
+#endif
+
+#ifdef TTL_ENABLE_BENCH
+namespace collections {
+  namespace array {
+    namespace {
+      using ::ttl::test::compare::Small;
+      using ::ttl::test::compare::Large;
+      using ::ttl::test::compare::Moving;
+      using ::ttl::test::compare::Expensive;
+      using ::ttl::test::compare::bench_emplace_drop;
+      using ::ttl::test::compare::bench_emplace_pop_into;
+      using ::ttl::test::compare::bench_push_clear;
+      using ::ttl::test::compare::bench_push_latency;
+      using ::ttl::test::compare::bench_push_pop;
+      using ::ttl::test::compare::bench_get;
+      using ::ttl::test::Bench;
+      using ::ttl::test::do_not_optimize;
+      using ::ttl::storage::ResizeCounter;
+      using ::ttl::storage::ResizeStats;
+
+      template <typename T> using FixedArray = Array<T, FixedCapacity>;
+
+      template <typename P>
+      void
+      bench_oscillate(Bench &bench) {
+        Array<Small, P, ResizeCounter> a(0);
+
+        for (::std::size_t j = 0; j < bench.arg; ++j)
+          Stack::push(a, Small(j));
+
+        ResizeStats stats = a.data.stats;
+        bench.ops = 4 * bench.arg;
+
+        for (::std::size_t i : bench) {
+          for (::std::size_t j = 0; j < 2 * bench.arg; ++j)
+            Stack::push(a, Small(i + j));
+          for (::std::size_t j = 0; j < 2 * bench.arg; ++j)
+            do_not_optimize(Stack::pop(a));
+        }
+
+        bench.counter("resizes", a.data.stats.resizes - stats.resizes);
+        bench.counter("bytes moved",
+                      a.data.stats.bytes_moved - stats.bytes_moved);
+      }
+
+      BENCHMARK_RANGE("policy/default/oscillate", 10, 100000) {
+        bench_oscillate<DefaultResizingPolicy>(bench);
+      }
+
+      BENCHMARK_RANGE("policy/doubling/oscillate", 10, 100000) {
+        bench_oscillate<DoublingResizingPolicy>(bench);
+      }
+
+      BENCHMARK_RANGE("policy/usable size/oscillate", 10, 100000) {
+        bench_oscillate<UsableSizeResizingPolicy>(bench);
+      }
+
+      BENCHMARK_RANGE("policy/grow only/oscillate", 10, 100000) {
+        bench_oscillate<GrowOnlyResizingPolicy>(bench);
+      }
+
+      BENCHMARK_RANGE("policy/hysteresis/oscillate", 10, 100000) {
+        bench_oscillate<HysteresisResizingPolicy<>>(bench);
+      }
+
+      BENCHMARK_RANGE("array/fixed/push_pop/small", 10, 100000000) {
+        bench_push_pop<Small>(bench, FixedArray<Small>(bench.arg));
+      }
+
+      BENCHMARK_RANGE("array/fixed/push_pop/large", 10, 100000000) {
+        bench_push_pop<Large>(bench, FixedArray<Large>(bench.arg));
+      }
+
+      BENCHMARK_RANGE("array/fixed/push_pop/moving", 10, 100000000) {
+        bench_push_pop<Moving>(bench, FixedArray<Moving>(bench.arg));
+      }
+
+      BENCHMARK_RANGE("array/resizing/push_pop/small", 10, 100000000) {
+        bench_push_pop<Small>(bench, Array<Small>(0));
+      }
+
+      BENCHMARK_RANGE("array/resizing/push_pop/large", 10, 100000000) {
+        bench_push_pop<Large>(bench, Array<Large>(0));
+      }
+
+      BENCHMARK_RANGE("array/resizing/push_pop/moving", 10, 100000000) {
+        bench_push_pop<Moving>(bench, Array<Moving>(0));
+      }
+
+      BENCHMARK_RANGE("array/resizing/push_pop/expensive", 10, 10000000) {
+        bench_push_pop<Expensive>(bench, Array<Expensive>(0));
+      }
+
+      BENCHMARK_RANGE("array/resizing/emplace_drop/expensive", 10, 10000000) {
+        bench_emplace_drop<Expensive>(bench, Array<Expensive>(0));
+      }
+
+      BENCHMARK_RANGE("array/resizing/emplace_pop_into/expensive", 10,
+                      10000000) {
+        bench_emplace_pop_into<Expensive>(bench, Array<Expensive>(0));
+      }
+
+      BENCHMARK_RANGE("array/resizing/push_clear/small", 10, 100000000) {
+        bench_push_clear<Small>(bench, Array<Small>(0));
+      }
+
+      BENCHMARK_RANGE("array/resizing/push_clear/moving", 10, 100000000) {
+        bench_push_clear<Moving>(bench, Array<Moving>(0));
+      }
+
+      BENCHMARK_RANGE("array/resizing/push_latency/small", 1000, 100000000) {
+        bench_push_latency<Small>(bench, Array<Small>(0));
+      }
+
+      BENCHMARK_RANGE("array/resizing/push_latency/large", 1000, 100000000) {
+        bench_push_latency<Large>(bench, Array<Large>(0));
+      }
+
+      BENCHMARK_RANGE("std::deque/push_latency/small", 1000, 100000000) {
+        bench_push_latency<Small>(bench, ::std::deque<Small>());
+      }
+
+      BENCHMARK_RANGE("std::deque/push_latency/large", 1000, 100000000) {
+        bench_push_latency<Large>(bench, ::std::deque<Large>());
+      }
+
+      BENCHMARK_RANGE("std::vector/push_clear/small", 10, 100000000) {
+        bench_push_clear<Small>(bench, ::std::vector<Small>());
+      }
+
+      BENCHMARK_RANGE("std::vector/push_clear/moving", 10, 100000000) {
+        bench_push_clear<Moving>(bench, ::std::vector<Moving>());
+      }
+
+      BENCHMARK_RANGE("std::vector/push_pop/small", 10, 100000000) {
+        bench_push_pop<Small>(bench, ::std::vector<Small>());
+      }
+
+      BENCHMARK_RANGE("std::vector/push_pop/large", 10, 100000000) {
+        bench_push_pop<Large>(bench, ::std::vector<Large>());
+      }
+
+      BENCHMARK_RANGE("std::vector/push_pop/moving", 10, 100000000) {
+        bench_push_pop<Moving>(bench, ::std::vector<Moving>());
+      }
+
+      BENCHMARK_RANGE("std::deque/push_pop/small", 10, 100000000) {
+        bench_push_pop<Small>(bench, ::std::deque<Small>());
+      }
+
+      BENCHMARK_RANGE("std::deque/push_pop/large", 10, 100000000) {
+        bench_push_pop<Large>(bench, ::std::deque<Large>());
+      }
+
+      BENCHMARK_RANGE("std::deque/push_pop/moving", 10, 100000000) {
+        bench_push_pop<Moving>(bench, ::std::deque<Moving>());
+      }
+
+      BENCHMARK_RANGE("array/fixed/get/small", 10, 100000000) {
+        bench_get<Small>(bench, FixedArray<Small>(bench.arg));
+      }
+
+      BENCHMARK_RANGE("array/fixed/get/large", 10, 100000000) {
+        bench_get<Large>(bench, FixedArray<Large>(bench.arg));
+      }
+
+      BENCHMARK_RANGE("array/fixed/get/moving", 10, 100000000) {
+        bench_get<Moving>(bench, FixedArray<Moving>(bench.arg));
+      }
+
+      BENCHMARK_RANGE("array/resizing/get/small", 10, 100000000) {
+        bench_get<Small>(bench, Array<Small>(0));
+      }
+
+      BENCHMARK_RANGE("array/resizing/get/large", 10, 100000000) {
+        bench_get<Large>(bench, Array<Large>(0));
+      }
+
+      BENCHMARK_RANGE("array/resizing/get/moving", 10, 100000000) {
+        bench_get<Moving>(bench, Array<Moving>(0));
+      }
+
+      BENCHMARK_RANGE("std::vector/get/small", 10, 100000000) {
+        bench_get<Small>(bench, ::std::vector<Small>());
+      }
+
+      BENCHMARK_RANGE("std::vector/get/large", 10, 100000000) {
+        bench_get<Large>(bench, ::std::vector<Large>());
+      }
+
+      BENCHMARK_RANGE("std::vector/get/moving", 10, 100000000) {
+        bench_get<Moving>(bench, ::std::vector<Moving>());
+      }
+
+      BENCHMARK_RANGE("std::deque/get/small", 10, 100000000) {
+        bench_get<Small>(bench, ::std::deque<Small>());
+      }
+
+      BENCHMARK_RANGE("std::deque/get/large", 10, 100000000) {
+        bench_get<Large>(bench, ::std::deque<Large>());
+      }
+
+      BENCHMARK_RANGE("std::deque/get/moving", 10, 100000000) {
+        bench_get<Moving>(bench, ::std::deque<Moving>());
       }
     }
   }
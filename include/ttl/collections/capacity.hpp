@@ -2,6 +2,20 @@ namespace collections {
   struct FixedCapacity {};
 
   struct DefaultResizingPolicy {};
+
+  struct DoublingResizingPolicy {};
+
+  struct UsableSizeResizingPolicy {};
+
+  struct GrowOnlyResizingPolicy {};
+
+  template <::std::size_t W = 64> struct HysteresisResizingPolicy {
+    ::std::size_t pending;
+
+    HysteresisResizingPolicy()
+        : pending(0) {
+    }
+  };
 }
 
 namespace traits {
@@ -23,13 +37,18 @@ namespace traits {
 
   template <>
   struct ResizingPolicy::Impl<::ttl::collections::DefaultResizingPolicy, void> {
+  private:
+    using DefaultResizingPolicy = ::ttl::collections::DefaultResizingPolicy;
+
+  public:
     static ::std::size_t
-    grow(::std::size_t capacity) {
+    grow(DefaultResizingPolicy &, ::std::size_t capacity) {
       return capacity + (capacity / 2u);
     }
 
     static ::std::size_t
-    shrink(::std::size_t size, ::std::size_t capacity) {
+    shrink(DefaultResizingPolicy &, ::std::size_t size,
+           ::std::size_t capacity) {
       ::std::size_t new_capacity;
 
       if (size * ::std::size_t(9u) / ::std::size_t(4u) < capacity) {
@@ -41,4 +60,151 @@ namespace traits {
       return ::std::max(::std::size_t(10u), new_capacity);
     }
   };
+
+  template <>
+  struct CapacityPolicy::Impl<::ttl::collections::DoublingResizingPolicy,
+                              void> {
+    static ::std::size_t
+    initial(::std::size_t capacity) {
+      ::std::size_t n = 8u;
+      while (n < capacity)
+        n *= 2u;
+      return n;
+    }
+  };
+
+  template <>
+  struct ResizingPolicy::Impl<::ttl::collections::DoublingResizingPolicy,
+                              void> {
+  private:
+    using DoublingResizingPolicy = ::ttl::collections::DoublingResizingPolicy;
+
+  public:
+    static ::std::size_t
+    grow(DoublingResizingPolicy &, ::std::size_t capacity) {
+      return CapacityPolicy::initial<DoublingResizingPolicy>(capacity * 2u);
+    }
+
+    static ::std::size_t
+    shrink(DoublingResizingPolicy &, ::std::size_t size,
+           ::std::size_t capacity) {
+      if ((capacity > 8u) && (size <= capacity / 4u))
+        return capacity / 2u;
+      return capacity;
+    }
+  };
+
+  template <>
+  struct CapacityPolicy::Impl<::ttl::collections::UsableSizeResizingPolicy,
+                              void> {
+    static ::std::size_t
+    initial(::std::size_t capacity) {
+      return CapacityPolicy::initial<::ttl::collections::DefaultResizingPolicy>(
+          capacity);
+    }
+  };
+
+  template <>
+  struct ResizingPolicy::Impl<::ttl::collections::UsableSizeResizingPolicy,
+                              void> {
+  private:
+    using UsableSizeResizingPolicy =
+        ::ttl::collections::UsableSizeResizingPolicy;
+    using DefaultResizingPolicy = ::ttl::collections::DefaultResizingPolicy;
+
+  public:
+    static ::std::size_t
+    grow(UsableSizeResizingPolicy &, ::std::size_t capacity) {
+      DefaultResizingPolicy base;
+      return ResizingPolicy::grow(base, capacity);
+    }
+
+    static ::std::size_t
+    shrink(UsableSizeResizingPolicy &, ::std::size_t size,
+           ::std::size_t capacity) {
+      DefaultResizingPolicy base;
+      return ResizingPolicy::shrink(base, size, capacity);
+    }
+
+    static ::std::size_t
+    fit(UsableSizeResizingPolicy &, ::std::size_t capacity,
+        ::std::size_t usable) {
+      return ::std::max(capacity, usable);
+    }
+  };
+
+  template <>
+  struct CapacityPolicy::Impl<::ttl::collections::GrowOnlyResizingPolicy,
+                              void> {
+    static ::std::size_t
+    initial(::std::size_t capacity) {
+      return CapacityPolicy::initial<::ttl::collections::DefaultResizingPolicy>(
+          capacity);
+    }
+  };
+
+  template <>
+  struct ResizingPolicy::Impl<::ttl::collections::GrowOnlyResizingPolicy,
+                              void> {
+  private:
+    using GrowOnlyResizingPolicy = ::ttl::collections::GrowOnlyResizingPolicy;
+    using DefaultResizingPolicy = ::ttl::collections::DefaultResizingPolicy;
+
+  public:
+    static ::std::size_t
+    grow(GrowOnlyResizingPolicy &, ::std::size_t capacity) {
+      DefaultResizingPolicy base;
+      return ResizingPolicy::grow(base, capacity);
+    }
+
+    static ::std::size_t
+    shrink(GrowOnlyResizingPolicy &, ::std::size_t, ::std::size_t capacity) {
+      return capacity;
+    }
+  };
+
+  template <::std::size_t W>
+  struct CapacityPolicy::Impl<::ttl::collections::HysteresisResizingPolicy<W>,
+                              void> {
+    static ::std::size_t
+    initial(::std::size_t capacity) {
+      return CapacityPolicy::initial<::ttl::collections::DefaultResizingPolicy>(
+          capacity);
+    }
+  };
+
+  template <::std::size_t W>
+  struct ResizingPolicy::Impl<::ttl::collections::HysteresisResizingPolicy<W>,
+                              void> {
+  private:
+    using HysteresisResizingPolicy =
+        ::ttl::collections::HysteresisResizingPolicy<W>;
+    using DefaultResizingPolicy = ::ttl::collections::DefaultResizingPolicy;
+
+  public:
+    static ::std::size_t
+    grow(HysteresisResizingPolicy &self, ::std::size_t capacity) {
+      DefaultResizingPolicy base;
+      self.pending = 0;
+      return ResizingPolicy::grow(base, capacity);
+    }
+
+    static ::std::size_t
+    shrink(HysteresisResizingPolicy &self, ::std::size_t size,
+           ::std::size_t capacity) {
+      DefaultResizingPolicy base;
+      ::std::size_t new_capacity = ResizingPolicy::shrink(base, size, capacity);
+
+      if (new_capacity >= capacity) {
+        self.pending = 0;
+        return capacity;
+      }
+
+      if (++self.pending < W)
+        return capacity;
+
+      self.pending = 0;
+      return new_capacity;
+    }
+  };
 }
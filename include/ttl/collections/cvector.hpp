@@ -0,0 +1,269 @@
+namespace collections {
+  namespace cvector {
+    using ::ttl::collections::SegmentedArray;
+
+    template <typename T, ::std::size_t B = 4, typename = void>
+    struct ConcurrentVector;
+
+    template <typename T, ::std::size_t B>
+    struct ConcurrentVector<
+        T, B,
+        typename ::std::enable_if<::std::is_nothrow_move_constructible<
+            T>::value && ::std::is_nothrow_destructible<T>::value>::type> {
+      static constexpr ::std::size_t MAX_SEGMENTS =
+          SegmentedArray<T, B>::MAX_SEGMENTS;
+
+      ::std::atomic<::std::size_t> reserved;
+      ::std::atomic<::std::size_t> published;
+      ::std::atomic<T *> data[MAX_SEGMENTS];
+
+      ConcurrentVector(ConcurrentVector const &) = delete;
+      ConcurrentVector &
+      operator=(ConcurrentVector const &) = delete;
+
+      ConcurrentVector()
+          : reserved(0)
+          , published(0)
+          , data() {
+      }
+
+      static ::std::size_t
+      segment_size(::std::size_t s) {
+        return ::std::size_t(1) << (B + s);
+      }
+
+      T *
+      get_ptr(::std::size_t index) const {
+        ::std::size_t s = SegmentedArray<T, B>::segment(index);
+        CHECK_FULL(s < MAX_SEGMENTS);
+        T *segment = data[s].load(::std::memory_order_acquire);
+        CHECK_FULL(segment != nullptr);
+        return segment + (index - SegmentedArray<T, B>::segment_base(s));
+      }
+
+      unsigned char *
+      get_flag(T *segment, ::std::size_t s, ::std::size_t index) const {
+        return reinterpret_cast<unsigned char *>(segment + segment_size(s)) +
+               (index - SegmentedArray<T, B>::segment_base(s));
+      }
+
+      bool
+      is_ready(::std::size_t index) const {
+        ::std::size_t s = SegmentedArray<T, B>::segment(index);
+        T *segment = data[s].load(::std::memory_order_acquire);
+        return (segment != nullptr) &&
+               __atomic_load_n(get_flag(segment, s, index), __ATOMIC_SEQ_CST);
+      }
+
+      T *
+      acquire_segment(::std::size_t s) {
+        T *segment = data[s].load(::std::memory_order_acquire);
+        if (segment != nullptr)
+          return segment;
+
+        T *allocated = static_cast<T *>(
+            ::std::calloc(segment_size(s), sizeof(T) + 1));
+        if (data[s].compare_exchange_strong(segment, allocated,
+                                            ::std::memory_order_acq_rel,
+                                            ::std::memory_order_acquire))
+          return allocated;
+
+        ::std::free(allocated);
+        return segment;
+      }
+
+      void
+      publish(T *segment, ::std::size_t s, ::std::size_t index) {
+        __atomic_store_n(get_flag(segment, s, index), 1, __ATOMIC_SEQ_CST);
+
+        ::std::size_t size = published.load();
+        while (is_ready(size))
+          if (published.compare_exchange_weak(size, size + 1))
+            size += 1;
+      }
+
+      ~ConcurrentVector() {
+        ::std::size_t size = published.load(::std::memory_order_acquire);
+        if (not::std::is_trivially_destructible<T>::value)
+          for (::std::size_t i = 0; i < size; ++i)
+            get_ptr(i)->~T();
+
+        for (::std::size_t s = 0; s < MAX_SEGMENTS; ++s)
+          ::std::free(data[s].load(::std::memory_order_relaxed));
+      }
+    };
+  }
+
+  using cvector::ConcurrentVector;
+}
+
+namespace traits {
+
+  template <typename T, ::std::size_t B>
+  struct Collection::Impl<::ttl::collections::ConcurrentVector<T, B>, void> {
+  private:
+    using ConcurrentVector = ::ttl::collections::ConcurrentVector<T, B>;
+
+  public:
+    static ::std::size_t
+    size(ConcurrentVector const &self) {
+      return self.published.load(::std::memory_order_acquire);
+    }
+  };
+
+  template <typename T, ::std::size_t B>
+  struct List::Impl<::ttl::collections::ConcurrentVector<T, B>, void> {
+  private:
+    using ConcurrentVector = ::ttl::collections::ConcurrentVector<T, B>;
+
+  public:
+    using Item = T;
+
+    static T const &
+    get(ConcurrentVector const &self, ::std::size_t index) {
+      CHECK(index < self.published.load(::std::memory_order_acquire));
+      return *self.get_ptr(index);
+    }
+  };
+
+  template <typename T, ::std::size_t B>
+  struct Append::Impl<::ttl::collections::ConcurrentVector<T, B>, void> {
+  private:
+    using ConcurrentVector = ::ttl::collections::ConcurrentVector<T, B>;
+    using SegmentedArray = ::ttl::collections::SegmentedArray<T, B>;
+
+  public:
+    using Item = T;
+
+    template <typename... Args>
+    static ::std::size_t
+    emplace(ConcurrentVector &self, Args &&... args) {
+      ::std::size_t index =
+          self.reserved.fetch_add(1, ::std::memory_order_relaxed);
+      ::std::size_t s = SegmentedArray::segment(index);
+      CHECK(s < ConcurrentVector::MAX_SEGMENTS);
+
+      T *segment = self.acquire_segment(s);
+      new (segment + (index - SegmentedArray::segment_base(s)))
+          T(::std::forward<Args>(args)...);
+
+      self.publish(segment, s, index);
+      return index;
+    }
+
+    static ::std::size_t
+    append(ConcurrentVector &self, T &&item) {
+      return emplace(self, ::std::move(item));
+    }
+  };
+}
+
+#ifdef TTL_ENABLE_TEST
+namespace collections {
+  namespace cvector {
+    namespace {
+      using ::ttl::test::AssertionFailure;
+      using ::ttl::test::Counter;
+      using ::ttl::traits::Append;
+      using ::ttl::traits::Collection;
+      using ::ttl::traits::List;
+
+      TESTCASE("test concurrent vector") {
+        SECTION("destruction") {
+          Counter::count = 0;
+          {
+            ConcurrentVector<Counter, 1> v;
+            for (::std::size_t i = 0; i < 10; ++i)
+              Append::emplace(v);
+            ASSERT(Counter::count == 0);
+          }
+          ASSERT(Counter::count == 10);
+        }
+
+        SECTION("append") {
+          ConcurrentVector<::std::size_t, 1> v;
+          for (::std::size_t i = 0; i < 1000; ++i)
+            ASSERT(Append::append(v, ::std::size_t(i)) == i);
+
+          ASSERT(Collection::size(v) == 1000);
+          for (::std::size_t i = 0; i < 1000; ++i)
+            ASSERT(List::get(v, i) == i);
+          ASSERT_THROW(AssertionFailure, List::get(v, 1000));
+        }
+
+        SECTION("threads") {
+          constexpr ::std::size_t THREADS = 4;
+          constexpr ::std::size_t COUNT = 20000;
+          ConcurrentVector<::std::size_t, 1> v;
+          ::std::atomic<bool> done(false);
+          bool consistent = true;
+
+          ::std::thread reader([&] {
+            while (not done.load(::std::memory_order_acquire)) {
+              ::std::size_t size = Collection::size(v);
+              for (::std::size_t i = 0; i < size; ++i)
+                if (List::get(v, i) == 0)
+                  consistent = false;
+            }
+          });
+
+          ::std::thread writers[THREADS];
+          for (::std::size_t t = 0; t < THREADS; ++t)
+            writers[t] = ::std::thread([&v, t] {
+              for (::std::size_t i = 0; i < COUNT; ++i)
+                Append::append(v, (t << 32) | (i + 1));
+            });
+
+          for (::std::size_t t = 0; t < THREADS; ++t)
+            writers[t].join();
+          done.store(true, ::std::memory_order_release);
+          reader.join();
+
+          ASSERT(consistent);
+          ASSERT(Collection::size(v) == THREADS * COUNT);
+
+          ::std::size_t last[THREADS] = {};
+          for (::std::size_t i = 0; i < THREADS * COUNT; ++i) {
+            ::std::size_t value = List::get(v, i);
+            ::std::size_t t = value >> 32;
+            ASSERT(t < THREADS);
+            ASSERT((value & 0xffffffffu) == last[t] + 1);
+            last[t] += 1;
+          }
+        }
+      }
+    }
+  }
+}
+#endif
+
+#ifdef TTL_ENABLE_BENCH
+namespace collections {
+  namespace cvector {
+    namespace {
+      using ::ttl::test::compare::Small;
+      using ::ttl::test::compare::Large;
+      using ::ttl::test::compare::Locked;
+      using ::ttl::test::compare::bench_append;
+
+      template <typename T> using LockedArray = Locked<Array<T>>;
+
+      BENCHMARK_RANGE("cvector/append/small", 1000, 10000000) {
+        bench_append<Small, ConcurrentVector<Small>>(bench);
+      }
+
+      BENCHMARK_RANGE("cvector/append/large", 1000, 10000000) {
+        bench_append<Large, ConcurrentVector<Large>>(bench);
+      }
+
+      BENCHMARK_RANGE("locked array/append/small", 1000, 10000000) {
+        bench_append<Small, LockedArray<Small>>(bench, 0);
+      }
+
+      BENCHMARK_RANGE("locked array/append/large", 1000, 10000000) {
+        bench_append<Large, LockedArray<Large>>(bench, 0);
+      }
+    }
+  }
+}
+#endif
@@ -8,6 +8,12 @@ namespace collections {
     template <typename T> struct Node {
       Node<T> *next;
       T data;
+
+      template <typename... Args>
+      Node(Node<T> *next, Args &&... args)
+          : next(next)
+          , data(::std::forward<Args>(args)...) {
+      }
     };
 
     template <typename T, typename A = SystemAllocator<Node<T>>,
@@ -23,26 +29,31 @@ namespace collections {
                 T>::value && ::std::is_nothrow_destructible<T>::value>::type>> {
       ::std::size_t size;
       Node<T> *top;
+      Node<T> *tail;
       A allocator;
 
       ForwardList()
           : size(0)
           , top(nullptr)
+          , tail(nullptr)
           , allocator({}) {
       }
 
       ForwardList(A &&a)
           : size(0)
           , top(nullptr)
+          , tail(nullptr)
           , allocator(::std::move(a)) {
       }
 
       ForwardList(ForwardList &&o) noexcept
           : size(0),
             top(nullptr),
+            tail(nullptr),
             allocator(::std::move(o.allocator)) {
         ::std::swap(size, o.size);
         ::std::swap(top, o.top);
+        ::std::swap(tail, o.tail);
       }
 
       static ForwardList
@@ -57,10 +68,184 @@ namespace collections {
       }
 
       ~ForwardList() {
-        while (!Stack::is_empty(*this))
-          Stack::pop(*this);
+        Stack::clear(*this);
       }
     };
+
+    static constexpr ::std::size_t BATCH = 64;
+
+    template <typename T, typename A>
+    void
+    push_n(ForwardList<T, A> &self, T *items, ::std::size_t n) {
+      Node<T> *ptrs[BATCH];
+
+      while (n > 0) {
+        ::std::size_t m = ::std::min(n, BATCH);
+        Node<T> *top = self.top;
+        Allocator::add_n(self.allocator, ptrs, m,
+                         [items, top, &ptrs](::std::size_t i) {
+                           return Node<T>((i == 0) ? top : ptrs[i - 1],
+                                          ::std::move(items[i]));
+                         });
+
+        if (top == nullptr)
+          self.tail = ptrs[0];
+        self.top = ptrs[m - 1];
+        self.size += m;
+        items += m;
+        n -= m;
+      }
+    }
+
+    template <typename T, typename A>
+    Node<T> *
+    unlink_n(ForwardList<T, A> &self, Node<T> **ptrs, ::std::size_t m) {
+      Node<T> *node = self.top;
+      for (::std::size_t i = 0; i < m; ++i) {
+        ptrs[i] = node;
+        node = node->next;
+      }
+      if (node == nullptr)
+        self.tail = nullptr;
+      self.size -= m;
+      return node;
+    }
+
+    template <typename T, typename A>
+    void
+    pop_n(ForwardList<T, A> &self, T *items, ::std::size_t n) {
+      CHECK(n <= self.size);
+      Node<T> *ptrs[BATCH];
+
+      while (n > 0) {
+        ::std::size_t m = ::std::min(n, BATCH);
+        self.top = unlink_n(self, ptrs, m);
+        Allocator::remove_n(self.allocator, ptrs, m,
+                            [items](::std::size_t i, Node<T> &&node) {
+                              items[i] = ::std::move(node.data);
+                            });
+        items += m;
+        n -= m;
+      }
+    }
+
+    template <typename T, typename A>
+    void
+    splice_front(ForwardList<T, A> &self, ForwardList<T, A> &other,
+                 ::std::size_t k) {
+      CHECK(k <= other.size);
+      CHECK(&self != &other);
+      CHECK(Allocator::shares(self.allocator, other.allocator));
+      if (k == 0)
+        return;
+
+      Node<T> *first = other.top;
+      Node<T> *last = first;
+      for (::std::size_t i = 1; i < k; ++i)
+        last = last->next;
+
+      other.top = last->next;
+      if (other.top == nullptr)
+        other.tail = nullptr;
+      other.size -= k;
+
+      last->next = self.top;
+      if (self.top == nullptr)
+        self.tail = last;
+      self.top = first;
+      self.size += k;
+    }
+
+    template <typename T, typename A>
+    void
+    concat(ForwardList<T, A> &self, ForwardList<T, A> &other) {
+      CHECK(&self != &other);
+      CHECK(Allocator::shares(self.allocator, other.allocator));
+      if (other.top == nullptr)
+        return;
+
+      if (self.top == nullptr)
+        self.top = other.top;
+      else
+        self.tail->next = other.top;
+
+      self.tail = other.tail;
+      self.size += other.size;
+      other.top = nullptr;
+      other.tail = nullptr;
+      other.size = 0;
+    }
+
+    template <typename T, typename A>
+    void
+    split_after(ForwardList<T, A> &self, ::std::size_t k,
+                ForwardList<T, A> &other) {
+      CHECK(k <= self.size);
+      CHECK(&self != &other);
+      CHECK(Allocator::shares(self.allocator, other.allocator));
+      if (k == self.size)
+        return;
+
+      Node<T> *first = self.top;
+      Node<T> *tail = self.tail;
+      ::std::size_t moved = self.size - k;
+
+      if (k == 0) {
+        self.top = nullptr;
+        self.tail = nullptr;
+      } else {
+        Node<T> *last = self.top;
+        for (::std::size_t i = 1; i < k; ++i)
+          last = last->next;
+        first = last->next;
+        last->next = nullptr;
+        self.tail = last;
+      }
+      self.size = k;
+
+      tail->next = other.top;
+      if (other.top == nullptr)
+        other.tail = tail;
+      other.top = first;
+      other.size += moved;
+    }
+
+    template <typename T, typename A>
+    void
+    reverse_front(ForwardList<T, A> &self, ::std::size_t k) {
+      CHECK(k <= self.size);
+      if (k < 2)
+        return;
+
+      Node<T> *first = self.top;
+      Node<T> *prev = nullptr;
+      Node<T> *node = self.top;
+      for (::std::size_t i = 0; i < k; ++i) {
+        Node<T> *next = node->next;
+        node->next = prev;
+        prev = node;
+        node = next;
+      }
+
+      first->next = node;
+      if (node == nullptr)
+        self.tail = first;
+      self.top = prev;
+    }
+
+    template <typename T, typename A>
+    void
+    drop_n(ForwardList<T, A> &self, ::std::size_t n) {
+      CHECK(n <= self.size);
+      Node<T> *ptrs[BATCH];
+
+      while (n > 0) {
+        ::std::size_t m = ::std::min(n, BATCH);
+        self.top = unlink_n(self, ptrs, m);
+        Allocator::destroy_n(self.allocator, ptrs, m);
+        n -= m;
+      }
+    }
   }
 
   using flist::ForwardList;
@@ -85,6 +270,20 @@ namespace traits {
   private:
     using ForwardList = ::ttl::collections::ForwardList<T, A>;
 
+    static void
+    release(ForwardList &self, ::std::true_type) {
+      Allocator::release_all(self.allocator);
+      self.size = 0;
+      self.top = nullptr;
+      self.tail = nullptr;
+    }
+
+    static void
+    release(ForwardList &self, ::std::false_type) {
+      while (not is_empty(self))
+        drop(self);
+    }
+
   public:
     using Item = T;
 
@@ -93,21 +292,56 @@ namespace traits {
       return self.top == nullptr;
     }
 
+    template <typename... Args>
     static void
-    push(ForwardList &self, T &&item) {
+    emplace(ForwardList &self, Args &&... args) {
+      self.top = Allocator::construct(self.allocator, self.top,
+                                      ::std::forward<Args>(args)...);
+      if (self.tail == nullptr)
+        self.tail = self.top;
       self.size += 1;
-      self.top = Allocator::add(self.allocator,
-                                {next : self.top, data : ::std::move(item)});
+    }
+
+    static void
+    push(ForwardList &self, T &&item) {
+      emplace(self, ::std::move(item));
     }
 
     static T
     pop(ForwardList &self) {
-      ASSERT(not is_empty(self));
+      CHECK(not is_empty(self));
+
+      auto *ptr = self.top;
+      T item(::std::move(ptr->data));
+      drop(self);
+      return item;
+    }
+
+    static void
+    pop_into(ForwardList &self, T &item) {
+      CHECK(not is_empty(self));
+
+      item = ::std::move(self.top->data);
+      drop(self);
+    }
+
+    static void
+    drop(ForwardList &self) {
+      CHECK(not is_empty(self));
 
       self.size -= 1;
       auto *ptr = self.top;
       self.top = ptr->next;
-      return Allocator::remove(self.allocator, ptr).data;
+      if (self.top == nullptr)
+        self.tail = nullptr;
+      Allocator::destroy(self.allocator, ptr);
+    }
+
+    static void
+    clear(ForwardList &self) {
+      release(self, ::std::integral_constant<
+                      bool, ::std::is_trivially_destructible<T>::value &&
+                                Allocator::releases_all<A>()>());
     }
   };
 }
@@ -118,6 +352,30 @@ namespace collections {
     namespace {
       using ::ttl::test::test_stack_destruction;
       using ::ttl::test::test_stack;
+      using ::ttl::test::test_stack_emplace;
+      using ::ttl::test::test_stack_pop_into;
+      using ::ttl::test::test_stack_clear;
+      using ::ttl::test::AssertionFailure;
+      using ::ttl::test::Counter;
+      using ::ttl::storage::Pool;
+      using ::ttl::storage::Shared;
+
+      template <typename L>
+      bool
+      equals(L const &l, ::std::initializer_list<::std::size_t> expected) {
+        if (l.size != expected.size())
+          return false;
+
+        auto *last = l.top;
+        auto *node = l.top;
+        for (::std::size_t value : expected) {
+          if (node->data != value)
+            return false;
+          last = node;
+          node = node->next;
+        }
+        return (node == nullptr) && (l.tail == last);
+      }
 
       TESTCASE("test flist") {
         SECTION("destruction") {
@@ -126,6 +384,321 @@ namespace collections {
         SECTION("stack") {
           test_stack<ForwardList>({{}});
         }
+        SECTION("emplace") {
+          test_stack_emplace<ForwardList>({{}});
+          test_stack_pop_into<ForwardList>({{}});
+        }
+        SECTION("clear") {
+          test_stack_clear<ForwardList>({{}});
+
+          ForwardList<::std::size_t, Pool<Node<::std::size_t>>> l(10);
+          for (::std::size_t i = 0; i < 10; i++)
+            Stack::push(l, ::std::move(i));
+          Stack::clear(l);
+          ASSERT(l.allocator.next == 0);
+          ASSERT(l.allocator.empty == nullptr);
+        }
+        SECTION("batch") {
+          ForwardList<::std::size_t, Pool<Node<::std::size_t>>> l(200);
+          ::std::size_t items[150];
+          for (::std::size_t i = 0; i < 150; i++)
+            items[i] = i;
+
+          push_n(l, items, 150);
+          ASSERT(l.size == 150);
+          ASSERT(Stack::pop(l) == 149);
+          ASSERT(Stack::pop(l) == 148);
+
+          pop_n(l, items, 100);
+          ASSERT(l.size == 48);
+          for (::std::size_t i = 0; i < 100; i++)
+            ASSERT(items[i] == 147 - i);
+          ASSERT_THROW(AssertionFailure, pop_n(l, items, 49));
+
+          drop_n(l, 40);
+          ASSERT(l.size == 8);
+          ASSERT(Stack::pop(l) == 7);
+
+          push_n(l, items, 150);
+          ASSERT(l.size == 157);
+          ASSERT(l.allocator.next == 157);
+        }
+        SECTION("splice") {
+          using SharedList =
+              ForwardList<::std::size_t, Shared<Pool<Node<::std::size_t>>>>;
+
+          Pool<Node<::std::size_t>> pool(20);
+          SharedList a(pool), b(pool);
+          for (::std::size_t i = 0; i < 5; i++)
+            Stack::push(a, ::std::move(i));
+          Stack::push(b, 10);
+
+          splice_front(b, a, 2);
+          ASSERT(equals(a, {2, 1, 0}));
+          ASSERT(equals(b, {4, 3, 10}));
+
+          concat(b, a);
+          ASSERT(equals(a, {}));
+          ASSERT(equals(b, {4, 3, 10, 2, 1, 0}));
+
+          split_after(b, 2, a);
+          ASSERT(equals(a, {10, 2, 1, 0}));
+          ASSERT(equals(b, {4, 3}));
+
+          split_after(b, 0, a);
+          ASSERT(equals(a, {4, 3, 10, 2, 1, 0}));
+          ASSERT(equals(b, {}));
+
+          concat(b, a);
+          splice_front(a, b, 6);
+          ASSERT(equals(a, {4, 3, 10, 2, 1, 0}));
+          ASSERT(equals(b, {}));
+
+          Stack::push(b, 7);
+          ASSERT(equals(b, {7}));
+          ASSERT(pool.next == 7);
+
+          ASSERT_THROW(AssertionFailure, splice_front(a, b, 2));
+          ASSERT_THROW(AssertionFailure, split_after(a, 7, b));
+          ASSERT_THROW(AssertionFailure, concat(a, a));
+
+          ForwardList<::std::size_t, Pool<Node<::std::size_t>>> c(1), d(1);
+          ASSERT_THROW(AssertionFailure, concat(c, d));
+        }
+        SECTION("reverse") {
+          ForwardList<::std::size_t> l;
+          for (::std::size_t i = 0; i < 5; i++)
+            Stack::push(l, ::std::move(i));
+
+          reverse_front(l, 3);
+          ASSERT(equals(l, {2, 3, 4, 1, 0}));
+          reverse_front(l, 5);
+          ASSERT(equals(l, {0, 1, 4, 3, 2}));
+          reverse_front(l, 1);
+          ASSERT(equals(l, {0, 1, 4, 3, 2}));
+          ASSERT_THROW(AssertionFailure, reverse_front(l, 6));
+        }
+        SECTION("batch destruction") {
+          Counter::count = 0;
+          Counter items[100];
+          {
+            ForwardList<Counter> l;
+            push_n(l, items, 100);
+            ASSERT(Counter::count == 0);
+            drop_n(l, 30);
+            ASSERT(Counter::count == 30);
+          }
+          ASSERT(Counter::count == 100);
+        }
+      }
+    }
+  }
+}
+#endif
+
+#ifdef TTL_ENABLE_BENCH
+namespace collections {
+  namespace flist {
+    namespace {
+      using ::ttl::storage::Pool;
+      using ::ttl::storage::Shared;
+      using ::ttl::test::Bench;
+      using ::ttl::test::do_not_optimize;
+      using ::ttl::test::compare::Small;
+      using ::ttl::test::compare::Large;
+      using ::ttl::test::compare::Moving;
+      using ::ttl::test::compare::Expensive;
+      using ::ttl::test::compare::bench_emplace_drop;
+      using ::ttl::test::compare::bench_emplace_pop_into;
+      using ::ttl::test::compare::bench_push_clear;
+      using ::ttl::test::compare::bench_push_pop;
+
+      template <typename T>
+      using PoolForwardList = ForwardList<T, Pool<Node<T>>>;
+
+      template <typename T, typename C>
+      void
+      bench_push_drop(Bench &bench, C &&c) {
+        ::std::vector<T> items;
+        for (::std::size_t j = 0; j < bench.arg; ++j)
+          items.emplace_back(j);
+        bench.ops = bench.arg;
+
+        for (::std::size_t i : bench) {
+          for (::std::size_t j = 0; j < bench.arg; ++j)
+            Stack::push(c, ::std::move(items[j]));
+          for (::std::size_t j = 0; j < bench.arg; ++j)
+            Stack::drop(c);
+          do_not_optimize(i);
+        }
+      }
+
+      template <typename T, typename C>
+      void
+      bench_push_n_drop_n(Bench &bench, C &&c) {
+        ::std::vector<T> items;
+        for (::std::size_t j = 0; j < bench.arg; ++j)
+          items.emplace_back(j);
+        bench.ops = bench.arg;
+
+        for (::std::size_t i : bench) {
+          push_n(c, items.data(), bench.arg);
+          drop_n(c, bench.arg);
+          do_not_optimize(i);
+        }
+      }
+
+      template <typename T, typename M>
+      void
+      bench_redistribute(Bench &bench, M move) {
+        using List = ForwardList<T, Shared<Pool<Node<T>>>>;
+        constexpr ::std::size_t LISTS = 4;
+
+        Pool<Node<T>> pool(bench.arg);
+        List lists[LISTS] = {List(pool), List(pool), List(pool), List(pool)};
+        for (::std::size_t j = 0; j < bench.arg; ++j)
+          Stack::push(lists[j % LISTS], T(j));
+
+        ::std::size_t k = bench.arg / (2 * LISTS);
+        bench.ops = LISTS * k;
+
+        for (::std::size_t i : bench) {
+          for (::std::size_t l = 0; l < LISTS; ++l)
+            move(lists[(l + i + 1) % LISTS], lists[(l + i) % LISTS], k);
+        }
+      }
+
+      template <typename T>
+      void
+      bench_redistribute_splice(Bench &bench) {
+        using List = ForwardList<T, Shared<Pool<Node<T>>>>;
+        bench_redistribute<T>(bench, [](List &to, List &from, ::std::size_t k) {
+          splice_front(to, from, k);
+        });
+      }
+
+      template <typename T>
+      void
+      bench_redistribute_pop_push(Bench &bench) {
+        using List = ForwardList<T, Shared<Pool<Node<T>>>>;
+        bench_redistribute<T>(bench, [](List &to, List &from, ::std::size_t k) {
+          for (::std::size_t j = 0; j < k; ++j)
+            Stack::push(to, Stack::pop(from));
+        });
+      }
+
+      BENCHMARK_RANGE("flist/shared/redistribute/splice/small", 1000,
+                      10000000) {
+        bench_redistribute_splice<Small>(bench);
+      }
+
+      BENCHMARK_RANGE("flist/shared/redistribute/pop_push/small", 1000,
+                      10000000) {
+        bench_redistribute_pop_push<Small>(bench);
+      }
+
+      BENCHMARK_RANGE("flist/shared/redistribute/splice/expensive", 1000,
+                      10000000) {
+        bench_redistribute_splice<Expensive>(bench);
+      }
+
+      BENCHMARK_RANGE("flist/shared/redistribute/pop_push/expensive", 1000,
+                      10000000) {
+        bench_redistribute_pop_push<Expensive>(bench);
+      }
+
+      BENCHMARK_RANGE("flist/system/push_pop/small", 10, 100000000) {
+        bench_push_pop<Small>(bench, ForwardList<Small>());
+      }
+
+      BENCHMARK_RANGE("flist/system/push_pop/large", 10, 100000000) {
+        bench_push_pop<Large>(bench, ForwardList<Large>());
+      }
+
+      BENCHMARK_RANGE("flist/system/push_pop/moving", 10, 100000000) {
+        bench_push_pop<Moving>(bench, ForwardList<Moving>());
+      }
+
+      BENCHMARK_RANGE("flist/pool/push_pop/small", 10, 100000000) {
+        bench_push_pop<Small>(bench,
+                              PoolForwardList<Small>(bench.arg));
+      }
+
+      BENCHMARK_RANGE("flist/pool/push_pop/large", 10, 100000000) {
+        bench_push_pop<Large>(bench,
+                              PoolForwardList<Large>(bench.arg));
+      }
+
+      BENCHMARK_RANGE("flist/pool/push_pop/moving", 10, 100000000) {
+        bench_push_pop<Moving>(bench,
+                               PoolForwardList<Moving>(bench.arg));
+      }
+
+      BENCHMARK_RANGE("flist/pool/push_pop/expensive", 10, 10000000) {
+        bench_push_pop<Expensive>(bench,
+                                  PoolForwardList<Expensive>(bench.arg));
+      }
+
+      BENCHMARK_RANGE("flist/pool/emplace_drop/expensive", 10, 10000000) {
+        bench_emplace_drop<Expensive>(bench,
+                                      PoolForwardList<Expensive>(bench.arg));
+      }
+
+      BENCHMARK_RANGE("flist/pool/emplace_pop_into/expensive", 10, 10000000) {
+        bench_emplace_pop_into<Expensive>(
+            bench, PoolForwardList<Expensive>(bench.arg));
+      }
+
+      BENCHMARK_RANGE("flist/system/push_clear/small", 10, 100000000) {
+        bench_push_clear<Small>(bench, ForwardList<Small>());
+      }
+
+      BENCHMARK_RANGE("flist/pool/push_clear/small", 10, 100000000) {
+        bench_push_clear<Small>(bench, PoolForwardList<Small>(bench.arg));
+      }
+
+      BENCHMARK_RANGE("flist/pool/push_clear/moving", 10, 100000000) {
+        bench_push_clear<Moving>(bench, PoolForwardList<Moving>(bench.arg));
+      }
+
+      BENCHMARK_RANGE("flist/system/push_drop/small", 1000, 10000000) {
+        bench_push_drop<Small>(bench, ForwardList<Small>());
+      }
+
+      BENCHMARK_RANGE("flist/system/push_n_drop_n/small", 1000, 10000000) {
+        bench_push_n_drop_n<Small>(bench, ForwardList<Small>());
+      }
+
+      BENCHMARK_RANGE("flist/pool/push_drop/small", 1000, 10000000) {
+        bench_push_drop<Small>(bench, PoolForwardList<Small>(bench.arg));
+      }
+
+      BENCHMARK_RANGE("flist/pool/push_n_drop_n/small", 1000, 10000000) {
+        bench_push_n_drop_n<Small>(bench, PoolForwardList<Small>(bench.arg));
+      }
+
+      BENCHMARK_RANGE("flist/pool/push_drop/moving", 1000, 10000000) {
+        bench_push_drop<Moving>(bench, PoolForwardList<Moving>(bench.arg));
+      }
+
+      BENCHMARK_RANGE("flist/pool/push_n_drop_n/moving", 1000, 10000000) {
+        bench_push_n_drop_n<Moving>(bench, PoolForwardList<Moving>(bench.arg));
+      }
+
+      BENCHMARK_RANGE("std::forward_list/push_clear/small", 10, 100000000) {
+        bench_push_clear<Small>(bench, ::std::forward_list<Small>());
+      }
+
+      BENCHMARK_RANGE("std::forward_list/push_pop/small", 10, 100000000) {
+        bench_push_pop<Small>(bench, ::std::forward_list<Small>());
+      }
+
+      BENCHMARK_RANGE("std::forward_list/push_pop/large", 10, 100000000) {
+        bench_push_pop<Large>(bench, ::std::forward_list<Large>());
+      }
+
+      BENCHMARK_RANGE("std::forward_list/push_pop/moving", 10, 100000000) {
+        bench_push_pop<Moving>(bench, ::std::forward_list<Moving>());
       }
     }
   }
@@ -0,0 +1,231 @@
+namespace collections {
+  namespace iflist {
+    using ::ttl::traits::IMPLEMENTS;
+    using ::ttl::traits::IndexAllocator;
+    using ::ttl::traits::Stack;
+    using ::ttl::storage::IndexPool;
+    using ::ttl::storage::NIL_INDEX;
+
+    template <typename T> struct IndexNode {
+      ::std::uint32_t next;
+      T data;
+
+      template <typename... Args>
+      IndexNode(::std::uint32_t next, Args &&... args)
+          : next(next)
+          , data(::std::forward<Args>(args)...) {
+      }
+    };
+
+    template <typename T, typename A = IndexPool<IndexNode<T>>,
+              typename = void>
+    struct IndexForwardList;
+
+    template <typename T, typename A>
+    struct IndexForwardList<
+        T, A,
+        ::std::void_t<
+            IMPLEMENTS<A, IndexAllocator>,
+            typename ::std::enable_if<::std::is_nothrow_move_constructible<
+                T>::value && ::std::is_nothrow_destructible<T>::value>::type>> {
+      ::std::size_t size;
+      ::std::uint32_t top;
+      A allocator;
+
+      IndexForwardList(A &&a)
+          : size(0)
+          , top(NIL_INDEX)
+          , allocator(::std::move(a)) {
+      }
+
+      IndexForwardList(IndexForwardList &&o) noexcept
+          : size(0),
+            top(NIL_INDEX),
+            allocator(::std::move(o.allocator)) {
+        ::std::swap(size, o.size);
+        ::std::swap(top, o.top);
+      }
+
+      ~IndexForwardList() {
+        Stack::clear(*this);
+      }
+    };
+  }
+
+  using iflist::IndexForwardList;
+}
+
+namespace traits {
+
+  template <typename T, typename A>
+  struct Collection::Impl<::ttl::collections::IndexForwardList<T, A>, void> {
+  private:
+    using IndexForwardList = ::ttl::collections::IndexForwardList<T, A>;
+
+  public:
+    static ::std::size_t
+    size(IndexForwardList const &self) {
+      return self.size;
+    }
+  };
+
+  template <typename T, typename A>
+  struct Stack::Impl<::ttl::collections::IndexForwardList<T, A>, void> {
+  private:
+    using IndexForwardList = ::ttl::collections::IndexForwardList<T, A>;
+
+    static void
+    release(IndexForwardList &self, ::std::true_type) {
+      IndexAllocator::release_all(self.allocator);
+      self.size = 0;
+      self.top = ::ttl::storage::NIL_INDEX;
+    }
+
+    static void
+    release(IndexForwardList &self, ::std::false_type) {
+      while (not is_empty(self))
+        drop(self);
+    }
+
+  public:
+    using Item = T;
+
+    static bool
+    is_empty(IndexForwardList const &self) {
+      return self.top == ::ttl::storage::NIL_INDEX;
+    }
+
+    template <typename... Args>
+    static void
+    emplace(IndexForwardList &self, Args &&... args) {
+      self.top = IndexAllocator::construct(self.allocator, self.top,
+                                           ::std::forward<Args>(args)...);
+      self.size += 1;
+    }
+
+    static void
+    push(IndexForwardList &self, T &&item) {
+      emplace(self, ::std::move(item));
+    }
+
+    static T
+    pop(IndexForwardList &self) {
+      CHECK(not is_empty(self));
+
+      T item(::std::move(IndexAllocator::get(self.allocator, self.top).data));
+      drop(self);
+      return item;
+    }
+
+    static void
+    pop_into(IndexForwardList &self, T &item) {
+      CHECK(not is_empty(self));
+
+      item = ::std::move(IndexAllocator::get(self.allocator, self.top).data);
+      drop(self);
+    }
+
+    static void
+    drop(IndexForwardList &self) {
+      CHECK(not is_empty(self));
+
+      self.size -= 1;
+      ::std::uint32_t index = self.top;
+      self.top = IndexAllocator::get(self.allocator, index).next;
+      IndexAllocator::destroy(self.allocator, index);
+    }
+
+    static void
+    clear(IndexForwardList &self) {
+      release(self, ::std::integral_constant<
+                      bool, ::std::is_trivially_destructible<T>::value &&
+                                IndexAllocator::releases_all<A>()>());
+    }
+  };
+}
+
+#ifdef TTL_ENABLE_TEST
+namespace collections {
+  namespace iflist {
+    namespace {
+      using ::ttl::test::test_stack_destruction;
+      using ::ttl::test::test_stack;
+      using ::ttl::test::test_stack_emplace;
+      using ::ttl::test::test_stack_pop_into;
+      using ::ttl::test::test_stack_clear;
+
+      TESTCASE("test iflist") {
+        SECTION("destruction") {
+          test_stack_destruction<IndexForwardList>({{10}});
+        }
+        SECTION("stack") {
+          test_stack<IndexForwardList>({{10}});
+        }
+        SECTION("emplace") {
+          test_stack_emplace<IndexForwardList>({{10}});
+          test_stack_pop_into<IndexForwardList>({{10}});
+        }
+        SECTION("clear") {
+          test_stack_clear<IndexForwardList>({{10}});
+
+          IndexForwardList<::std::uint32_t> l(10);
+          for (::std::uint32_t i = 0; i < 10; i++)
+            Stack::push(l, ::std::move(i));
+          Stack::clear(l);
+          ASSERT(l.allocator.next == 0);
+          ASSERT(l.allocator.empty == NIL_INDEX);
+        }
+        SECTION("node size") {
+          ASSERT(sizeof(IndexNode<::std::uint32_t>) == 8);
+          ASSERT(sizeof(IndexNode<::std::uint32_t>) * 2 <=
+                 sizeof(::ttl::collections::flist::Node<::std::uint32_t>));
+        }
+      }
+    }
+  }
+}
+#endif
+
+#ifdef TTL_ENABLE_BENCH
+namespace collections {
+  namespace iflist {
+    namespace {
+      using ::ttl::test::compare::Small;
+      using ::ttl::test::compare::Large;
+      using ::ttl::test::compare::Moving;
+      using ::ttl::test::compare::Expensive;
+      using ::ttl::test::compare::bench_emplace_drop;
+      using ::ttl::test::compare::bench_emplace_pop_into;
+      using ::ttl::test::compare::bench_push_pop;
+
+      BENCHMARK_RANGE("iflist/pool/push_pop/small", 10, 100000000) {
+        bench_push_pop<Small>(bench, IndexForwardList<Small>(bench.arg));
+      }
+
+      BENCHMARK_RANGE("iflist/pool/push_pop/large", 10, 100000000) {
+        bench_push_pop<Large>(bench, IndexForwardList<Large>(bench.arg));
+      }
+
+      BENCHMARK_RANGE("iflist/pool/push_pop/moving", 10, 100000000) {
+        bench_push_pop<Moving>(bench, IndexForwardList<Moving>(bench.arg));
+      }
+
+      BENCHMARK_RANGE("iflist/pool/push_pop/expensive", 10, 10000000) {
+        bench_push_pop<Expensive>(bench,
+                                  IndexForwardList<Expensive>(bench.arg));
+      }
+
+      BENCHMARK_RANGE("iflist/pool/emplace_drop/expensive", 10, 10000000) {
+        bench_emplace_drop<Expensive>(bench,
+                                      IndexForwardList<Expensive>(bench.arg));
+      }
+
+      BENCHMARK_RANGE("iflist/pool/emplace_pop_into/expensive", 10,
+                      10000000) {
+        bench_emplace_pop_into<Expensive>(
+            bench, IndexForwardList<Expensive>(bench.arg));
+      }
+    }
+  }
+}
+#endif
@@ -0,0 +1,619 @@
+namespace collections {
+  namespace lru {
+    using ::ttl::traits::Allocator;
+    using ::ttl::storage::Chunk;
+    using ::ttl::storage::Pool;
+
+    struct Links {
+      Links *prev;
+      Links *next;
+    };
+
+    template <typename K, typename V> struct Node : Links {
+      ::std::size_t hash;
+      K key;
+      V value;
+
+      Node(::std::size_t hash, K &&key, V &&value)
+          : Links{nullptr, nullptr}
+          , hash(hash)
+          , key(::std::move(key))
+          , value(::std::move(value)) {
+      }
+    };
+
+    template <typename K, typename V> struct Entry {
+      ::std::size_t hash;
+      Node<K, V> *node;
+    };
+
+    template <typename H, typename K>
+    ::std::size_t
+    hash(H const &hasher, K const &key) {
+      ::std::uint64_t h = hasher(key);
+      h = (h ^ (h >> 33)) * 0xff51afd7ed558ccdu;
+      h = (h ^ (h >> 33)) * 0xc4ceb9fe1a85ec53u;
+      return ::std::size_t(h ^ (h >> 33));
+    }
+
+    constexpr ::std::size_t
+    index_size(::std::size_t capacity) {
+      return (capacity < 4) ? 8 : ::std::size_t(1)
+                                      << (65 - __builtin_clzll(capacity - 1));
+    }
+
+    template <typename K, typename V, typename H = ::std::hash<K>,
+              typename = void>
+    struct LruCache;
+
+    template <typename K, typename V, typename H>
+    struct LruCache<
+        K, V, H,
+        typename ::std::enable_if<
+            ::std::is_nothrow_move_constructible<K>::value &&
+            ::std::is_nothrow_move_constructible<V>::value &&
+            ::std::is_nothrow_destructible<K>::value &&
+            ::std::is_nothrow_destructible<V>::value>::type> {
+      using Key = K;
+      using Value = V;
+
+      ::std::size_t capacity;
+      ::std::size_t size;
+      ::std::size_t mask;
+      Links recent;
+      Pool<Node<K, V>> pool;
+      Chunk<Entry<K, V>> index;
+      H hasher;
+
+      LruCache(LruCache const &) = delete;
+      LruCache &
+      operator=(LruCache const &) = delete;
+
+      LruCache(::std::size_t capacity, H &&hasher = {})
+          : capacity(capacity)
+          , size(0)
+          , mask(index_size(capacity) - 1)
+          , recent{&recent, &recent}
+          , pool(capacity)
+          , index(index_size(capacity))
+          , hasher(::std::move(hasher)) {
+        CHECK(capacity > 0);
+        for (::std::size_t i = 0; i <= mask; ++i)
+          index.get(i).node = nullptr;
+      }
+
+      LruCache(LruCache &&o) noexcept
+          : capacity(o.capacity),
+            size(o.size),
+            mask(o.mask),
+            recent{&recent, &recent},
+            pool(::std::move(o.pool)),
+            index(::std::move(o.index)),
+            hasher(::std::move(o.hasher)) {
+        if (size > 0) {
+          recent = o.recent;
+          recent.next->prev = &recent;
+          recent.prev->next = &recent;
+        }
+        o.size = 0;
+        o.recent = {&o.recent, &o.recent};
+      }
+
+      ~LruCache() {
+        while (recent.next != &recent) {
+          Links *links = recent.next;
+          recent.next = links->next;
+          Allocator::destroy(pool, static_cast<Node<K, V> *>(links));
+        }
+      }
+    };
+
+    template <typename K, typename V, typename H>
+    ::std::size_t
+    find(LruCache<K, V, H> const &self, ::std::size_t h, K const &key) {
+      for (::std::size_t i = h & self.mask;; i = (i + 1) & self.mask) {
+        Entry<K, V> const &entry = self.index.get(i);
+        if (entry.node == nullptr)
+          return i;
+        if ((entry.hash == h) && (entry.node->key == key))
+          return i;
+      }
+    }
+
+    inline void
+    unlink(Links *links) {
+      links->prev->next = links->next;
+      links->next->prev = links->prev;
+    }
+
+    template <typename K, typename V, typename H>
+    void
+    link_front(LruCache<K, V, H> &self, Links *links) {
+      links->prev = &self.recent;
+      links->next = self.recent.next;
+      self.recent.next->prev = links;
+      self.recent.next = links;
+    }
+
+    template <typename K, typename V, typename H>
+    void
+    remove_at(LruCache<K, V, H> &self, ::std::size_t i) {
+      Node<K, V> *node = self.index.get(i).node;
+      ::std::size_t j = i;
+
+      while (true) {
+        j = (j + 1) & self.mask;
+        Entry<K, V> &entry = self.index.get(j);
+        if (entry.node == nullptr)
+          break;
+        ::std::size_t home = entry.hash & self.mask;
+        if (((j - home) & self.mask) >= ((j - i) & self.mask)) {
+          self.index.get(i) = entry;
+          i = j;
+        }
+      }
+      self.index.get(i).node = nullptr;
+
+      unlink(node);
+      Allocator::destroy(self.pool, node);
+      self.size -= 1;
+    }
+
+    template <typename K, typename V, typename H>
+    V *
+    get(LruCache<K, V, H> &self, typename LruCache<K, V, H>::Key const &key) {
+      ::std::size_t i = find(self, hash(self.hasher, key), key);
+      Node<K, V> *node = self.index.get(i).node;
+      if (node == nullptr)
+        return nullptr;
+
+      unlink(node);
+      link_front(self, node);
+      return &node->value;
+    }
+
+    template <typename K, typename V, typename H>
+    V const *
+    peek(LruCache<K, V, H> const &self,
+         typename LruCache<K, V, H>::Key const &key) {
+      ::std::size_t i = find(self, hash(self.hasher, key), key);
+      Node<K, V> const *node = self.index.get(i).node;
+      return (node == nullptr) ? nullptr : &node->value;
+    }
+
+    template <typename K, typename V, typename H>
+    bool
+    evict(LruCache<K, V, H> &self) {
+      if (self.size == 0)
+        return false;
+
+      Node<K, V> *node = static_cast<Node<K, V> *>(self.recent.prev);
+      remove_at(self, find(self, node->hash, node->key));
+      return true;
+    }
+
+    template <typename K, typename V, typename H>
+    bool
+    erase(LruCache<K, V, H> &self,
+          typename LruCache<K, V, H>::Key const &key) {
+      ::std::size_t i = find(self, hash(self.hasher, key), key);
+      if (self.index.get(i).node == nullptr)
+        return false;
+
+      remove_at(self, i);
+      return true;
+    }
+
+    template <typename K, typename V, typename H>
+    bool
+    put(LruCache<K, V, H> &self, typename LruCache<K, V, H>::Key &&key,
+        typename LruCache<K, V, H>::Value &&value) {
+      ::std::size_t h = hash(self.hasher, key);
+      ::std::size_t i = find(self, h, key);
+      Node<K, V> *node = self.index.get(i).node;
+
+      if (node != nullptr) {
+        node->value.~V();
+        new (&node->value) V(::std::move(value));
+        unlink(node);
+        link_front(self, node);
+        return false;
+      }
+
+      if (self.size == self.capacity) {
+        evict(self);
+        i = find(self, h, key);
+      }
+
+      node = Allocator::construct(self.pool, h, ::std::move(key),
+                                  ::std::move(value));
+      self.index.get(i) = {h, node};
+      link_front(self, node);
+      self.size += 1;
+      return true;
+    }
+
+    struct alignas(64) Lock {
+      mutable ::std::mutex mutex;
+    };
+
+    template <typename K, typename V, typename H = ::std::hash<K>,
+              ::std::size_t N = 16>
+    struct ShardedLruCache {
+      using Key = K;
+      using Value = V;
+
+      Lock locks[N];
+      Chunk<LruCache<K, V, H>> shards;
+      H hasher;
+
+      ShardedLruCache(ShardedLruCache const &) = delete;
+      ShardedLruCache &
+      operator=(ShardedLruCache const &) = delete;
+
+      ShardedLruCache(::std::size_t capacity)
+          : locks()
+          , shards(N)
+          , hasher() {
+        for (::std::size_t i = 0; i < N; ++i)
+          shards.emplace(i, (capacity + N - 1) / N);
+      }
+
+      ~ShardedLruCache() {
+        shards.destroy_n(N);
+      }
+    };
+
+    template <typename K, typename V, typename H, ::std::size_t N>
+    ::std::size_t
+    shard(ShardedLruCache<K, V, H, N> const &self, K const &key) {
+      return (hash(self.hasher, key) >> 40) % N;
+    }
+
+    template <typename K, typename V, typename H, ::std::size_t N>
+    bool
+    get(ShardedLruCache<K, V, H, N> &self,
+        typename ShardedLruCache<K, V, H, N>::Key const &key, V &value) {
+      ::std::size_t i = shard(self, key);
+      ::std::lock_guard<::std::mutex> guard(self.locks[i].mutex);
+      V *found = get(self.shards.get(i), key);
+      if (found == nullptr)
+        return false;
+      value = *found;
+      return true;
+    }
+
+    template <typename K, typename V, typename H, ::std::size_t N>
+    bool
+    put(ShardedLruCache<K, V, H, N> &self,
+        typename ShardedLruCache<K, V, H, N>::Key &&key,
+        typename ShardedLruCache<K, V, H, N>::Value &&value) {
+      ::std::size_t i = shard(self, key);
+      ::std::lock_guard<::std::mutex> guard(self.locks[i].mutex);
+      return put(self.shards.get(i), ::std::move(key), ::std::move(value));
+    }
+
+    template <typename K, typename V, typename H, ::std::size_t N>
+    bool
+    erase(ShardedLruCache<K, V, H, N> &self,
+          typename ShardedLruCache<K, V, H, N>::Key const &key) {
+      ::std::size_t i = shard(self, key);
+      ::std::lock_guard<::std::mutex> guard(self.locks[i].mutex);
+      return erase(self.shards.get(i), key);
+    }
+  }
+
+  using lru::LruCache;
+  using lru::ShardedLruCache;
+}
+
+namespace traits {
+
+  template <typename K, typename V, typename H>
+  struct Collection::Impl<::ttl::collections::LruCache<K, V, H>, void> {
+  private:
+    using LruCache = ::ttl::collections::LruCache<K, V, H>;
+
+  public:
+    static ::std::size_t
+    size(LruCache const &self) {
+      return self.size;
+    }
+  };
+
+  template <typename K, typename V, typename H>
+  struct Bounded::Impl<::ttl::collections::LruCache<K, V, H>, void> {
+  private:
+    using LruCache = ::ttl::collections::LruCache<K, V, H>;
+
+  public:
+    static ::std::size_t
+    capacity(LruCache const &self) {
+      return self.capacity;
+    }
+  };
+
+  template <typename K, typename V, typename H, ::std::size_t N>
+  struct Collection::Impl<::ttl::collections::ShardedLruCache<K, V, H, N>,
+                          void> {
+  private:
+    using ShardedLruCache = ::ttl::collections::ShardedLruCache<K, V, H, N>;
+
+  public:
+    static ::std::size_t
+    size(ShardedLruCache const &self) {
+      ::std::size_t size = 0;
+      for (::std::size_t i = 0; i < N; ++i) {
+        ::std::lock_guard<::std::mutex> guard(self.locks[i].mutex);
+        size += self.shards.get(i).size;
+      }
+      return size;
+    }
+  };
+}
+
+#ifdef TTL_ENABLE_TEST
+namespace collections {
+  namespace lru {
+    namespace {
+      using ::ttl::test::AssertionFailure;
+      using ::ttl::test::Counter;
+      using ::ttl::traits::Bounded;
+      using ::ttl::traits::Collection;
+
+      struct Collide {
+        ::std::size_t
+        operator()(::std::uint64_t key) const {
+          return key & 1;
+        }
+      };
+
+      TESTCASE("test lru cache") {
+        LruCache<::std::uint64_t, ::std::uint64_t> cache(3);
+        ASSERT(Bounded::capacity(cache) == 3);
+        ASSERT_THROW(AssertionFailure,
+                     (LruCache<::std::uint64_t, ::std::uint64_t>(0)));
+
+        SECTION("recency") {
+          ASSERT(put(cache, 1, 10));
+          ASSERT(put(cache, 2, 20));
+          ASSERT(put(cache, 3, 30));
+          ASSERT(*get(cache, 1) == 10);
+          ASSERT(put(cache, 4, 40));
+          ASSERT(Collection::size(cache) == 3);
+          ASSERT(get(cache, 2) == nullptr);
+          ASSERT(*peek(cache, 3) == 30);
+          ASSERT(put(cache, 5, 50));
+          ASSERT(peek(cache, 3) == nullptr);
+          ASSERT(*get(cache, 1) == 10);
+          ASSERT(*get(cache, 4) == 40);
+          ASSERT(*get(cache, 5) == 50);
+        }
+
+        SECTION("update") {
+          put(cache, 1, 10);
+          put(cache, 2, 20);
+          put(cache, 3, 30);
+          ASSERT(not put(cache, 1, 11));
+          ASSERT(Collection::size(cache) == 3);
+          put(cache, 4, 40);
+          ASSERT(*get(cache, 1) == 11);
+          ASSERT(get(cache, 2) == nullptr);
+        }
+
+        SECTION("erase") {
+          put(cache, 1, 10);
+          put(cache, 2, 20);
+          ASSERT(erase(cache, 1));
+          ASSERT(not erase(cache, 1));
+          ASSERT(Collection::size(cache) == 1);
+          ASSERT(evict(cache));
+          ASSERT(not evict(cache));
+          ASSERT(get(cache, 2) == nullptr);
+        }
+
+        SECTION("collisions") {
+          LruCache<::std::uint64_t, ::std::uint64_t, Collide> collide(64);
+          for (::std::uint64_t i = 0; i < 64; ++i)
+            put(collide, ::std::move(i), i * 2);
+          for (::std::uint64_t i = 0; i < 64; i += 3)
+            ASSERT(erase(collide, i));
+          for (::std::uint64_t i = 0; i < 64; ++i) {
+            ::std::uint64_t const *value = peek(collide, i);
+            if (i % 3 == 0) {
+              ASSERT(value == nullptr);
+            } else {
+              ASSERT(*value == i * 2);
+            }
+          }
+          for (::std::uint64_t i = 100; i < 200; ++i)
+            put(collide, ::std::move(i), ::std::move(i));
+          ASSERT(Collection::size(collide) == 64);
+          for (::std::uint64_t i = 136; i < 200; ++i)
+            ASSERT(*peek(collide, i) == i);
+        }
+
+        SECTION("no allocation") {
+          for (::std::uint64_t i = 0; i < 1000; ++i)
+            put(cache, ::std::move(i), ::std::move(i));
+          ASSERT(cache.pool.next == 3);
+        }
+
+        SECTION("move") {
+          put(cache, 1, 10);
+          put(cache, 2, 20);
+          LruCache<::std::uint64_t, ::std::uint64_t> moved(::std::move(cache));
+          ASSERT(Collection::size(cache) == 0);
+          put(moved, 3, 30);
+          put(moved, 4, 40);
+          ASSERT(get(moved, 1) == nullptr);
+          ASSERT(*get(moved, 2) == 20);
+        }
+
+        SECTION("destruction") {
+          Counter::count = 0;
+          {
+            LruCache<::std::uint64_t, Counter> counters(2);
+            put(counters, 1, {});
+            put(counters, 2, {});
+            put(counters, 1, {});
+            ASSERT(Counter::count == 1);
+            put(counters, 3, {});
+            ASSERT(Counter::count == 2);
+            ASSERT(get(counters, 1)->valid);
+          }
+          ASSERT(Counter::count == 4);
+        }
+      }
+
+      TESTCASE("test sharded lru cache") {
+        ShardedLruCache<::std::uint64_t, ::std::uint64_t, ::std::hash<
+            ::std::uint64_t>, 4> cache(1000);
+        ::std::uint64_t value = 0;
+
+        SECTION("basic") {
+          ASSERT(put(cache, 1, 10));
+          ASSERT(get(cache, 1, value));
+          ASSERT(value == 10);
+          ASSERT(not get(cache, 2, value));
+          ASSERT(erase(cache, 1));
+          ASSERT(Collection::size(cache) == 0);
+        }
+
+        SECTION("threads") {
+          ::std::thread threads[4];
+          for (::std::uint64_t t = 0; t < 4; ++t)
+            threads[t] = ::std::thread([&cache, t] {
+              ::std::uint64_t found;
+              for (::std::uint64_t i = t; i < 10000; i += 4) {
+                put(cache, ::std::move(i), i + 1);
+                if (get(cache, i, found)) {
+                  ASSERT(found == i + 1);
+                }
+              }
+            });
+          for (::std::thread &thread : threads)
+            thread.join();
+          ::std::size_t found = 0;
+          for (::std::uint64_t i = 0; i < 10000; ++i) {
+            if (get(cache, i, value)) {
+              ASSERT(value == i + 1);
+              found += 1;
+            }
+          }
+          ASSERT(found == Collection::size(cache));
+          ASSERT(found > 0);
+          ASSERT(found <= 1000);
+        }
+      }
+    }
+  }
+}
+#endif
+
+#ifdef TTL_ENABLE_BENCH
+namespace collections {
+  namespace lru {
+    namespace {
+      using ::ttl::test::Bench;
+      using ::ttl::test::Random;
+      using ::ttl::test::do_not_optimize;
+
+      struct StdLru {
+        using List = ::std::list<::std::pair<::std::uint64_t, ::std::uint64_t>>;
+
+        ::std::size_t capacity;
+        List recent;
+        ::std::unordered_map<::std::uint64_t, List::iterator> index;
+
+        StdLru(::std::size_t capacity)
+            : capacity(capacity) {
+          index.reserve(capacity);
+        }
+
+        ::std::uint64_t *
+        get(::std::uint64_t key) {
+          auto it = index.find(key);
+          if (it == index.end())
+            return nullptr;
+          recent.splice(recent.begin(), recent, it->second);
+          return &it->second->second;
+        }
+
+        void
+        put(::std::uint64_t key, ::std::uint64_t value) {
+          auto it = index.find(key);
+          if (it != index.end()) {
+            it->second->second = value;
+            recent.splice(recent.begin(), recent, it->second);
+            return;
+          }
+          if (index.size() == capacity) {
+            index.erase(recent.back().first);
+            recent.pop_back();
+          }
+          recent.emplace_front(key, value);
+          index.emplace(key, recent.begin());
+        }
+      };
+
+      BENCHMARK_RANGE("lru/get", 1000, 1000000) {
+        LruCache<::std::uint64_t, ::std::uint64_t> cache(bench.arg);
+        for (::std::uint64_t i = 0; i < bench.arg; ++i)
+          put(cache, ::std::move(i), ::std::move(i));
+        Random random;
+
+        for (::std::size_t i : bench) {
+          do_not_optimize(*get(cache, random.next() % bench.arg));
+          do_not_optimize(i);
+        }
+      }
+
+      BENCHMARK_RANGE("lru/std/get", 1000, 1000000) {
+        StdLru cache(bench.arg);
+        for (::std::uint64_t i = 0; i < bench.arg; ++i)
+          cache.put(i, i);
+        Random random;
+
+        for (::std::size_t i : bench) {
+          do_not_optimize(*cache.get(random.next() % bench.arg));
+          do_not_optimize(i);
+        }
+      }
+
+      BENCHMARK_RANGE("lru/sharded/get", 1000, 1000000) {
+        ShardedLruCache<::std::uint64_t, ::std::uint64_t> cache(bench.arg);
+        for (::std::uint64_t i = 0; i < bench.arg; ++i)
+          put(cache, ::std::move(i), ::std::move(i));
+        Random random;
+        ::std::uint64_t value = 0;
+
+        for (::std::size_t i : bench) {
+          get(cache, random.next() % bench.arg, value);
+          do_not_optimize(value);
+          do_not_optimize(i);
+        }
+      }
+
+      BENCHMARK_RANGE("lru/put", 1000, 1000000) {
+        LruCache<::std::uint64_t, ::std::uint64_t> cache(bench.arg);
+        Random random;
+
+        for (::std::size_t i : bench) {
+          do_not_optimize(put(cache, random.next(), ::std::move(i)));
+        }
+      }
+
+      BENCHMARK_RANGE("lru/std/put", 1000, 1000000) {
+        StdLru cache(bench.arg);
+        Random random;
+
+        for (::std::size_t i : bench) {
+          cache.put(random.next(), i);
+          do_not_optimize(cache.index.size());
+        }
+      }
+    }
+  }
+}
+#endif
@@ -0,0 +1,393 @@
+namespace collections {
+  namespace marray {
+    using ::ttl::traits::IMPLEMENTS;
+    using ::ttl::traits::CapacityPolicy;
+    using ::ttl::traits::ResizingPolicy;
+    using ::ttl::storage::Mapping;
+
+    template <typename T, typename P = DefaultResizingPolicy,
+              typename = void>
+    struct MappedArray;
+
+    template <typename T, typename P>
+    struct MappedArray<T, P, IMPLEMENTS<P, ResizingPolicy>> {
+      Mapping<T> data;
+      P policy;
+
+      MappedArray(P &&policy = {})
+          : data()
+          , policy(::std::move(policy)) {
+      }
+
+      MappedArray(MappedArray &&o) noexcept
+          : data(::std::move(o.data)),
+            policy(::std::move(o.policy)) {
+      }
+    };
+
+    template <typename T, typename P>
+    bool
+    open(MappedArray<T, P> &self, char const *path, ::std::size_t capacity) {
+      return self.data.open(path, CapacityPolicy::initial<P>(capacity));
+    }
+
+    template <typename T, typename P>
+    bool
+    sync(MappedArray<T, P> &self) {
+      return self.data.sync();
+    }
+
+    template <typename T, typename P>
+    void
+    close(MappedArray<T, P> &self) {
+      self.data.close();
+    }
+
+    template <typename T, typename P>
+    void
+    resize(MappedArray<T, P> &self, ::std::size_t capacity) {
+      if (not self.data.resize(capacity))
+        throw ::std::bad_alloc();
+    }
+
+    template <typename T, typename P>
+    void
+    shrink(MappedArray<T, P> &self) {
+      ::std::size_t capacity = self.data.capacity;
+      ::std::size_t new_capacity =
+          ResizingPolicy::shrink(self.policy, self.data.header->size, capacity);
+
+      if (new_capacity < capacity)
+        resize(self, new_capacity);
+    }
+  }
+
+  using marray::MappedArray;
+}
+
+namespace traits {
+
+  template <typename T, typename P>
+  struct Collection::Impl<::ttl::collections::MappedArray<T, P>, void> {
+  private:
+    using MappedArray = ::ttl::collections::MappedArray<T, P>;
+
+  public:
+    static ::std::size_t
+    size(MappedArray const &self) {
+      return self.data.is_open() ? self.data.header->size : 0;
+    }
+  };
+
+  template <typename T, typename P>
+  struct Unbounded::Impl<::ttl::collections::MappedArray<T, P>, void> {
+  private:
+    using MappedArray = ::ttl::collections::MappedArray<T, P>;
+
+  public:
+    static ::std::size_t
+    capacity(MappedArray const &self) {
+      return self.data.capacity;
+    }
+
+    static void
+    reserve(MappedArray &self, ::std::size_t capacity) {
+      if (capacity > self.data.capacity)
+        ::ttl::collections::marray::resize(self, capacity);
+    }
+
+    static void
+    shrink_to_fit(MappedArray &self) {
+      ::std::size_t capacity =
+          CapacityPolicy::initial<P>(self.data.header->size);
+      if (capacity < self.data.capacity)
+        ::ttl::collections::marray::resize(self, capacity);
+    }
+  };
+
+  template <typename T, typename P>
+  struct List::Impl<::ttl::collections::MappedArray<T, P>, void> {
+  private:
+    using MappedArray = ::ttl::collections::MappedArray<T, P>;
+
+  public:
+    using Item = T;
+
+    static T const &
+    get(MappedArray const &self, ::std::size_t index) {
+      CHECK(index < Collection::size(self));
+      return self.data.get(index);
+    }
+  };
+
+  template <typename T, typename P>
+  struct ListMut::Impl<::ttl::collections::MappedArray<T, P>, void> {
+  private:
+    using MappedArray = ::ttl::collections::MappedArray<T, P>;
+
+  public:
+    using Item = T;
+
+    static T &
+    get(MappedArray &self, ::std::size_t index) {
+      CHECK(index < Collection::size(self));
+      return self.data.get(index);
+    }
+  };
+
+  template <typename T, typename P>
+  struct Contiguous::Impl<::ttl::collections::MappedArray<T, P>, void> {
+  private:
+    using MappedArray = ::ttl::collections::MappedArray<T, P>;
+
+  public:
+    using Item = T;
+
+    static T *
+    data(MappedArray &self) {
+      return self.data.data;
+    }
+  };
+
+  template <typename T, typename P>
+  struct Stack::Impl<::ttl::collections::MappedArray<T, P>, void> {
+  private:
+    using MappedArray = ::ttl::collections::MappedArray<T, P>;
+
+  public:
+    using Item = T;
+
+    static bool
+    is_empty(MappedArray const &self) {
+      return Collection::size(self) == 0;
+    }
+
+    template <typename... Args>
+    static void
+    emplace(MappedArray &self, Args &&... args) {
+      CHECK(self.data.is_open());
+
+      ::std::size_t size = self.data.header->size;
+      if (size == self.data.capacity)
+        ::ttl::collections::marray::resize(
+            self, ResizingPolicy::grow(self.policy, size));
+
+      self.data.get(size) = T(::std::forward<Args>(args)...);
+      self.data.header->size = size + 1;
+    }
+
+    static void
+    push(MappedArray &self, T &&item) {
+      emplace(self, ::std::move(item));
+    }
+
+    static T
+    pop(MappedArray &self) {
+      CHECK(not is_empty(self));
+
+      T item = self.data.get(--self.data.header->size);
+      ::ttl::collections::marray::shrink(self);
+      return item;
+    }
+
+    static void
+    pop_into(MappedArray &self, T &item) {
+      item = pop(self);
+    }
+
+    static void
+    drop(MappedArray &self) {
+      CHECK(not is_empty(self));
+
+      self.data.header->size -= 1;
+      ::ttl::collections::marray::shrink(self);
+    }
+
+    static void
+    clear(MappedArray &self) {
+      CHECK(self.data.is_open());
+
+      self.data.header->size = 0;
+      ::ttl::collections::marray::shrink(self);
+    }
+  };
+}
+
+#ifdef TTL_ENABLE_TEST
+namespace collections {
+  namespace marray {
+    namespace {
+      using ::ttl::test::AssertionFailure;
+      using ::ttl::test::TempFile;
+      using ::ttl::traits::Collection;
+      using ::ttl::traits::List;
+      using ::ttl::traits::ListMut;
+      using ::ttl::traits::Stack;
+      using ::ttl::traits::Unbounded;
+
+      struct Record {
+        ::std::uint64_t key;
+        double value;
+      };
+
+      TESTCASE("test mapped array") {
+        TempFile file;
+        MappedArray<Record> array;
+        ASSERT(Collection::size(array) == 0);
+        ASSERT_THROW(AssertionFailure, Stack::push(array, {1, 1.0}));
+        ASSERT(open(array, file.path, 0));
+        ASSERT(Unbounded::capacity(array) == 10);
+
+        SECTION("stack") {
+          for (::std::uint64_t i = 0; i < 100; ++i)
+            Stack::push(array, {i, double(i) / 2});
+          ASSERT(Collection::size(array) == 100);
+          ASSERT(Unbounded::capacity(array) >= 100);
+          ASSERT(List::get(array, 42).value == 21.0);
+          ListMut::get(array, 42).value = 0;
+
+          Record item;
+          Stack::pop_into(array, item);
+          ASSERT(item.key == 99);
+          for (::std::size_t i = 0; i < 90; ++i)
+            Stack::drop(array);
+          ASSERT(Stack::pop(array).key == 8);
+          ASSERT(Unbounded::capacity(array) < 100);
+          Stack::clear(array);
+          ASSERT(Stack::is_empty(array));
+        }
+
+        SECTION("reopen") {
+          for (::std::uint64_t i = 0; i < 1000; ++i)
+            Stack::push(array, {i, double(i)});
+          ASSERT(sync(array));
+          ::std::size_t capacity = Unbounded::capacity(array);
+          close(array);
+          ASSERT(Collection::size(array) == 0);
+
+          MappedArray<Record> reopened;
+          ASSERT(open(reopened, file.path, 0));
+          ASSERT(Collection::size(reopened) == 1000);
+          ASSERT(Unbounded::capacity(reopened) == capacity);
+          ASSERT(List::get(reopened, 999).key == 999);
+          ASSERT_THROW(AssertionFailure, List::get(reopened, 1000));
+
+          Unbounded::shrink_to_fit(reopened);
+          ASSERT(Unbounded::capacity(reopened) == 1000);
+          Unbounded::reserve(reopened, 5000);
+          ASSERT(Unbounded::capacity(reopened) == 5000);
+        }
+
+        SECTION("mismatch") {
+          close(array);
+          MappedArray<::std::uint64_t> other;
+          errno = 0;
+          ASSERT(not open(other, file.path, 0));
+          ASSERT(errno == EINVAL);
+        }
+      }
+    }
+  }
+}
+#endif
+
+#ifdef TTL_ENABLE_BENCH
+namespace collections {
+  namespace marray {
+    namespace {
+      using ::ttl::test::Bench;
+      using ::ttl::test::TempFile;
+      using ::ttl::test::do_not_optimize;
+      using ::ttl::traits::Collection;
+      using ::ttl::traits::List;
+      using ::ttl::traits::Stack;
+      using ::ttl::traits::Unbounded;
+
+      struct Record {
+        ::std::uint64_t key;
+        ::std::uint64_t values[7];
+      };
+
+      void
+      create(char const *path, ::std::size_t n) {
+        MappedArray<Record> array;
+        open(array, path, n);
+        for (::std::uint64_t i = 0; i < n; ++i)
+          Stack::push(array, {i, {i, i, i, i, i, i, i}});
+        sync(array);
+      }
+
+      BENCHMARK_RANGE("marray/startup/open", 1000, 1000000) {
+        TempFile file;
+        create(file.path, bench.arg);
+
+        for (::std::size_t i : bench) {
+          MappedArray<Record> array;
+          open(array, file.path, 0);
+          do_not_optimize(List::get(array, bench.arg - 1).key);
+          do_not_optimize(i);
+        }
+      }
+
+      BENCHMARK_RANGE("marray/startup/read", 1000, 1000000) {
+        TempFile file;
+        create(file.path, bench.arg);
+        using ::ttl::storage::mapped::Header;
+
+        for (::std::size_t i : bench) {
+          ::ttl::collections::Array<Record> array(0);
+          ::std::FILE *f = ::std::fopen(file.path, "rb");
+          Header header;
+          if (::std::fread(&header, sizeof(header), 1, f) == 1) {
+            Unbounded::reserve(array, header.size);
+            array.size = ::std::fread(array.data.data, sizeof(Record),
+                                      header.size, f);
+          }
+          ::std::fclose(f);
+          do_not_optimize(List::get(array, bench.arg - 1).key);
+          do_not_optimize(i);
+        }
+      }
+
+      BENCHMARK_RANGE("marray/startup/deserialize", 1000, 1000000) {
+        TempFile file;
+        create(file.path, bench.arg);
+        using ::ttl::storage::mapped::Header;
+
+        for (::std::size_t i : bench) {
+          ::ttl::collections::Array<Record> array(0);
+          ::std::FILE *f = ::std::fopen(file.path, "rb");
+          Header header;
+          Record record;
+          if (::std::fread(&header, sizeof(header), 1, f) == 1) {
+            for (::std::uint64_t j = 0; j < header.size; ++j) {
+              if (::std::fread(&record, sizeof(record), 1, f) != 1)
+                break;
+              Stack::push(array, ::std::move(record));
+            }
+          }
+          ::std::fclose(f);
+          do_not_optimize(List::get(array, bench.arg - 1).key);
+          do_not_optimize(i);
+        }
+      }
+
+      BENCHMARK_RANGE("marray/startup/scan", 1000, 1000000) {
+        TempFile file;
+        create(file.path, bench.arg);
+        bench.ops = bench.arg;
+
+        for (::std::size_t i : bench) {
+          MappedArray<Record> array;
+          open(array, file.path, 0);
+          ::std::uint64_t sum = 0;
+          for (::std::size_t j = 0; j < Collection::size(array); ++j)
+            sum += List::get(array, j).values[j % 7];
+          do_not_optimize(sum);
+          do_not_optimize(i);
+        }
+      }
+    }
+  }
+}
+#endif
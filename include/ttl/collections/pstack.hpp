@@ -0,0 +1,415 @@
+namespace collections {
+  namespace pstack {
+    using ::ttl::traits::IMPLEMENTS;
+    using ::ttl::traits::Allocator;
+    using ::ttl::storage::SystemAllocator;
+
+    enum class Sharing { ATOMIC, LOCAL };
+
+    template <Sharing S> struct Count;
+
+    template <> struct Count<Sharing::LOCAL> {
+      ::std::size_t value;
+
+      Count(::std::size_t value)
+          : value(value) {
+      }
+
+      void
+      acquire() {
+        value += 1;
+      }
+
+      bool
+      release() {
+        return --value == 0;
+      }
+    };
+
+    template <> struct Count<Sharing::ATOMIC> {
+      ::std::atomic<::std::size_t> value;
+
+      Count(::std::size_t value)
+          : value(value) {
+      }
+
+      Count(Count &&o) noexcept
+          : value(o.value.load(::std::memory_order_relaxed)) {
+      }
+
+      void
+      acquire() {
+        value.fetch_add(1, ::std::memory_order_relaxed);
+      }
+
+      bool
+      release() {
+        if (value.fetch_sub(1, ::std::memory_order_release) != 1)
+          return false;
+        ::std::atomic_thread_fence(::std::memory_order_acquire);
+        return true;
+      }
+    };
+
+    template <typename T, Sharing S> struct Node {
+      Count<S> refs;
+      Node<T, S> *next;
+      T data;
+
+      template <typename... Args>
+      Node(Node<T, S> *next, Args &&... args)
+          : refs(1)
+          , next(next)
+          , data(::std::forward<Args>(args)...) {
+      }
+    };
+
+    template <typename T, Sharing S = Sharing::ATOMIC,
+              typename A = SystemAllocator<Node<T, S>>, typename = void>
+    struct PersistentStack;
+
+    template <typename T, Sharing S, typename A>
+    struct PersistentStack<
+        T, S, A,
+        ::std::void_t<
+            IMPLEMENTS<A, Allocator>,
+            typename ::std::enable_if<::std::is_nothrow_move_constructible<
+                T>::value && ::std::is_nothrow_destructible<T>::value>::type>> {
+      using Item = T;
+
+      ::std::size_t size;
+      Node<T, S> *top;
+      A *allocator;
+
+      PersistentStack(A &allocator)
+          : size(0)
+          , top(nullptr)
+          , allocator(&allocator) {
+      }
+
+      PersistentStack(A *allocator, Node<T, S> *top, ::std::size_t size)
+          : size(size)
+          , top(top)
+          , allocator(allocator) {
+      }
+
+      PersistentStack(PersistentStack const &o)
+          : size(o.size)
+          , top(o.top)
+          , allocator(o.allocator) {
+        if (top != nullptr)
+          top->refs.acquire();
+      }
+
+      PersistentStack(PersistentStack &&o) noexcept
+          : size(o.size),
+            top(o.top),
+            allocator(o.allocator) {
+        o.size = 0;
+        o.top = nullptr;
+      }
+
+      PersistentStack &
+      operator=(PersistentStack const &o) {
+        PersistentStack copy(o);
+        return *this = ::std::move(copy);
+      }
+
+      PersistentStack &
+      operator=(PersistentStack &&o) noexcept {
+        CHECK(Allocator::shares(*allocator, *o.allocator));
+        ::std::swap(size, o.size);
+        ::std::swap(top, o.top);
+        return *this;
+      }
+
+      ~PersistentStack() {
+        Node<T, S> *node = top;
+        while ((node != nullptr) && node->refs.release()) {
+          Node<T, S> *next = node->next;
+          Allocator::destroy(*allocator, node);
+          node = next;
+        }
+      }
+    };
+
+    template <typename T, Sharing S, typename A>
+    bool
+    is_empty(PersistentStack<T, S, A> const &self) {
+      return self.top == nullptr;
+    }
+
+    template <typename T, Sharing S, typename A>
+    T const &
+    top(PersistentStack<T, S, A> const &self) {
+      CHECK(not is_empty(self));
+      return self.top->data;
+    }
+
+    template <typename T, Sharing S, typename A, typename... Args>
+    PersistentStack<T, S, A>
+    emplace(PersistentStack<T, S, A> const &self, Args &&... args) {
+      Node<T, S> *node = Allocator::construct(*self.allocator, self.top,
+                                              ::std::forward<Args>(args)...);
+      if (self.top != nullptr)
+        self.top->refs.acquire();
+      return {self.allocator, node, self.size + 1};
+    }
+
+    template <typename T, Sharing S, typename A>
+    PersistentStack<T, S, A>
+    push(PersistentStack<T, S, A> const &self,
+         typename PersistentStack<T, S, A>::Item &&item) {
+      return emplace(self, ::std::move(item));
+    }
+
+    template <typename T, Sharing S, typename A>
+    PersistentStack<T, S, A>
+    pop(PersistentStack<T, S, A> const &self) {
+      CHECK(not is_empty(self));
+
+      Node<T, S> *next = self.top->next;
+      if (next != nullptr)
+        next->refs.acquire();
+      return {self.allocator, next, self.size - 1};
+    }
+
+    template <typename T, Sharing S, typename A>
+    bool
+    shares(PersistentStack<T, S, A> const &self,
+           PersistentStack<T, S, A> const &other) {
+      return (self.top == other.top) && (self.size == other.size);
+    }
+  }
+
+  using pstack::PersistentStack;
+  using pstack::Sharing;
+}
+
+namespace traits {
+
+  template <typename T, ::ttl::collections::Sharing S, typename A>
+  struct Collection::Impl<::ttl::collections::PersistentStack<T, S, A>, void> {
+  private:
+    using PersistentStack = ::ttl::collections::PersistentStack<T, S, A>;
+
+  public:
+    static ::std::size_t
+    size(PersistentStack const &self) {
+      return self.size;
+    }
+  };
+}
+
+#ifdef TTL_ENABLE_TEST
+namespace collections {
+  namespace pstack {
+    namespace {
+      using ::ttl::test::AssertionFailure;
+      using ::ttl::test::Counter;
+      using ::ttl::storage::Pool;
+      using ::ttl::traits::Collection;
+
+      template <typename L>
+      bool
+      equals(L const &l, ::std::initializer_list<::std::size_t> expected) {
+        if (Collection::size(l) != expected.size())
+          return false;
+
+        auto *node = l.top;
+        for (::std::size_t value : expected) {
+          if (node->data != value)
+            return false;
+          node = node->next;
+        }
+        return node == nullptr;
+      }
+
+      template <Sharing S>
+      void
+      test_versions() {
+        SystemAllocator<Node<::std::size_t, S>> allocator{};
+        PersistentStack<::std::size_t, S> empty(allocator);
+        ASSERT(is_empty(empty));
+        ASSERT_THROW(AssertionFailure, top(empty));
+        ASSERT_THROW(AssertionFailure, pop(empty));
+
+        auto a = push(push(empty, 1), 2);
+        auto b = push(a, 3);
+        auto c = push(pop(b), 4);
+        ASSERT(equals(empty, {}));
+        ASSERT(equals(a, {2, 1}));
+        ASSERT(equals(b, {3, 2, 1}));
+        ASSERT(equals(c, {4, 2, 1}));
+        ASSERT(top(c) == 4);
+        ASSERT(b.top->next == a.top);
+        ASSERT(c.top->next == a.top);
+
+        auto snapshot = a;
+        ASSERT(shares(snapshot, a));
+        ASSERT(not shares(snapshot, b));
+        a = pop(a);
+        ASSERT(equals(a, {1}));
+        ASSERT(equals(snapshot, {2, 1}));
+        a = empty;
+        ASSERT(is_empty(a));
+        ASSERT(equals(b, {3, 2, 1}));
+      }
+
+      TESTCASE("test pstack") {
+        SECTION("versions") {
+          test_versions<Sharing::ATOMIC>();
+          test_versions<Sharing::LOCAL>();
+        }
+        SECTION("sharing") {
+          SystemAllocator<Node<::std::size_t, Sharing::LOCAL>> allocator{};
+          PersistentStack<::std::size_t, Sharing::LOCAL> a(allocator);
+          a = push(push(a, 1), 2);
+          ASSERT(a.top->refs.value == 1);
+          ASSERT(a.top->next->refs.value == 1);
+          {
+            auto b = a;
+            auto c = pop(a);
+            ASSERT(a.top->refs.value == 2);
+            ASSERT(a.top->next->refs.value == 2);
+          }
+          ASSERT(a.top->refs.value == 1);
+          ASSERT(a.top->next->refs.value == 1);
+        }
+        SECTION("destruction") {
+          Counter::count = 0;
+          SystemAllocator<Node<Counter, Sharing::ATOMIC>> allocator{};
+          {
+            PersistentStack<Counter> a(allocator);
+            a = emplace(emplace(a));
+            {
+              auto b = emplace(a);
+              auto c = pop(a);
+              a = c;
+              ASSERT(Counter::count == 0);
+            }
+            ASSERT(Counter::count == 2);
+          }
+          ASSERT(Counter::count == 3);
+        }
+        SECTION("long chain") {
+          SystemAllocator<Node<::std::size_t, Sharing::LOCAL>> allocator{};
+          PersistentStack<::std::size_t, Sharing::LOCAL> a(allocator);
+          for (::std::size_t i = 0; i < 1000000; ++i)
+            a = push(a, ::std::move(i));
+          ASSERT(Collection::size(a) == 1000000);
+        }
+        SECTION("pool") {
+          Pool<Node<::std::size_t, Sharing::LOCAL>> pool(4);
+          using Stack =
+              PersistentStack<::std::size_t, Sharing::LOCAL, decltype(pool)>;
+          Stack a(pool);
+          a = push(push(push(a, 1), 2), 3);
+          Stack b = push(pop(pop(a)), 4);
+          ASSERT(pool.next == 4);
+          ASSERT(equals(b, {4, 1}));
+          a = b;
+          ASSERT(equals(a, {4, 1}));
+          a = push(a, 5);
+          ASSERT(pool.next == 4);
+          ASSERT(equals(a, {5, 4, 1}));
+        }
+      }
+    }
+  }
+}
+#endif
+
+#ifdef TTL_ENABLE_BENCH
+namespace collections {
+  namespace pstack {
+    namespace {
+      using ::ttl::traits::Stack;
+      using ::ttl::test::Bench;
+      using ::ttl::test::do_not_optimize;
+      using ::ttl::collections::ForwardList;
+
+      BENCHMARK_RANGE("pstack/snapshot", 10, 1000000) {
+        SystemAllocator<Node<::std::size_t, Sharing::ATOMIC>> allocator{};
+        PersistentStack<::std::size_t> stack(allocator);
+        for (::std::size_t j = 0; j < bench.arg; ++j)
+          stack = push(stack, ::std::move(j));
+
+        for (::std::size_t i : bench) {
+          PersistentStack<::std::size_t> snapshot(stack);
+          do_not_optimize(snapshot.top);
+          do_not_optimize(i);
+        }
+      }
+
+      BENCHMARK_RANGE("pstack/local/snapshot", 10, 1000000) {
+        SystemAllocator<Node<::std::size_t, Sharing::LOCAL>> allocator{};
+        PersistentStack<::std::size_t, Sharing::LOCAL> stack(allocator);
+        for (::std::size_t j = 0; j < bench.arg; ++j)
+          stack = push(stack, ::std::move(j));
+
+        for (::std::size_t i : bench) {
+          PersistentStack<::std::size_t, Sharing::LOCAL> snapshot(stack);
+          do_not_optimize(snapshot.top);
+          do_not_optimize(i);
+        }
+      }
+
+      BENCHMARK_RANGE("pstack/flist/copy", 10, 1000000) {
+        ForwardList<::std::size_t> list;
+        for (::std::size_t j = 0; j < bench.arg; ++j)
+          Stack::push(list, ::std::move(j));
+        bench.ops = bench.arg;
+
+        for (::std::size_t i : bench) {
+          ForwardList<::std::size_t> copy;
+          for (auto *node = list.top; node != nullptr; node = node->next)
+            Stack::push(copy, ::std::size_t(node->data));
+          do_not_optimize(copy.top);
+          do_not_optimize(i);
+        }
+      }
+
+      BENCHMARK_RANGE("pstack/std::forward_list/copy", 10, 1000000) {
+        ::std::forward_list<::std::size_t> list;
+        for (::std::size_t j = 0; j < bench.arg; ++j)
+          list.push_front(j);
+        bench.ops = bench.arg;
+
+        for (::std::size_t i : bench) {
+          ::std::forward_list<::std::size_t> copy(list);
+          do_not_optimize(copy.front());
+          do_not_optimize(i);
+        }
+      }
+
+      template <Sharing S>
+      void
+      bench_push_pop(Bench &bench) {
+        SystemAllocator<Node<::std::size_t, S>> allocator{};
+        PersistentStack<::std::size_t, S> base(allocator);
+        base = push(base, 0);
+        bench.ops = bench.arg;
+
+        for (::std::size_t i : bench) {
+          PersistentStack<::std::size_t, S> stack(base);
+          for (::std::size_t j = 0; j < bench.arg; ++j)
+            stack = push(stack, ::std::move(j));
+          for (::std::size_t j = 0; j < bench.arg; ++j)
+            stack = pop(stack);
+          do_not_optimize(stack.top);
+          do_not_optimize(i);
+        }
+      }
+
+      BENCHMARK_RANGE("pstack/push_pop", 10, 100000) {
+        bench_push_pop<Sharing::ATOMIC>(bench);
+      }
+
+      BENCHMARK_RANGE("pstack/local/push_pop", 10, 100000) {
+        bench_push_pop<Sharing::LOCAL>(bench);
+      }
+    }
+  }
+}
+#endif
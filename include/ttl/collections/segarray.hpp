@@ -0,0 +1,339 @@
+namespace collections {
+  namespace segarray {
+    using ::ttl::traits::Stack;
+
+    template <typename T, ::std::size_t B = 4, typename = void>
+    struct SegmentedArray;
+
+    template <typename T, ::std::size_t B>
+    struct SegmentedArray<
+        T, B,
+        typename ::std::enable_if<::std::is_nothrow_move_constructible<
+            T>::value && ::std::is_nothrow_destructible<T>::value>::type> {
+      static constexpr ::std::size_t MAX_SEGMENTS = 63 - B;
+
+      ::std::size_t size;
+      ::std::size_t segments;
+      T *data[MAX_SEGMENTS];
+
+      SegmentedArray(SegmentedArray const &) = delete;
+      SegmentedArray &
+      operator=(SegmentedArray const &) = delete;
+
+      SegmentedArray()
+          : size(0)
+          , segments(0)
+          , data() {
+      }
+
+      SegmentedArray(SegmentedArray &&o) noexcept : size(0),
+                                                    segments(0),
+                                                    data() {
+        ::std::swap(size, o.size);
+        ::std::swap(segments, o.segments);
+        ::std::swap(data, o.data);
+      }
+
+      static ::std::size_t
+      segment(::std::size_t index) {
+        return 63 - __builtin_clzll(index + (::std::size_t(1) << B)) - B;
+      }
+
+      static ::std::size_t
+      segment_base(::std::size_t segment) {
+        return (::std::size_t(1) << (B + segment)) - (::std::size_t(1) << B);
+      }
+
+      ::std::size_t
+      capacity() const {
+        return segment_base(segments);
+      }
+
+      T *
+      get_ptr(::std::size_t index) {
+        ::std::size_t s = segment(index);
+        CHECK_FULL(s < segments);
+        return data[s] + (index - segment_base(s));
+      }
+
+      T const *
+      get_ptr(::std::size_t index) const {
+        ::std::size_t s = segment(index);
+        CHECK_FULL(s < segments);
+        return data[s] + (index - segment_base(s));
+      }
+
+      void
+      grow() {
+        CHECK(segments < MAX_SEGMENTS);
+        data[segments] = static_cast<T *>(
+            ::std::malloc(sizeof(T) << (B + segments)));
+        segments += 1;
+      }
+
+      void
+      trim() {
+        ::std::size_t used = (size > 0) ? segment(size - 1) + 1 : 0;
+        while (segments > used + 1)
+          ::std::free(data[--segments]);
+      }
+
+      void
+      destroy_all() {
+        if (not::std::is_trivially_destructible<T>::value)
+          for (::std::size_t i = 0; i < size; ++i)
+            get_ptr(i)->~T();
+        size = 0;
+      }
+
+      ~SegmentedArray() {
+        destroy_all();
+        while (segments > 0)
+          ::std::free(data[--segments]);
+      }
+    };
+
+    template <typename T, ::std::size_t B>
+    constexpr ::std::size_t SegmentedArray<
+        T, B,
+        typename ::std::enable_if<::std::is_nothrow_move_constructible<
+            T>::value && ::std::is_nothrow_destructible<T>::value>::type>::
+        MAX_SEGMENTS;
+  }
+
+  using segarray::SegmentedArray;
+}
+
+namespace traits {
+
+  template <typename T, ::std::size_t B>
+  struct Collection::Impl<::ttl::collections::SegmentedArray<T, B>, void> {
+  private:
+    using SegmentedArray = ::ttl::collections::SegmentedArray<T, B>;
+
+  public:
+    static ::std::size_t
+    size(SegmentedArray const &self) {
+      return self.size;
+    }
+  };
+
+  template <typename T, ::std::size_t B>
+  struct List::Impl<::ttl::collections::SegmentedArray<T, B>, void> {
+  private:
+    using SegmentedArray = ::ttl::collections::SegmentedArray<T, B>;
+
+  public:
+    using Item = T;
+
+    static T const &
+    get(SegmentedArray const &self, ::std::size_t index) {
+      CHECK(index < self.size);
+      return *self.get_ptr(index);
+    }
+  };
+
+  template <typename T, ::std::size_t B>
+  struct ListMut::Impl<::ttl::collections::SegmentedArray<T, B>, void> {
+  private:
+    using SegmentedArray = ::ttl::collections::SegmentedArray<T, B>;
+
+  public:
+    using Item = T;
+
+    static T &
+    get(SegmentedArray &self, ::std::size_t index) {
+      CHECK(index < self.size);
+      return *self.get_ptr(index);
+    }
+  };
+
+  template <typename T, ::std::size_t B>
+  struct Stack::Impl<::ttl::collections::SegmentedArray<T, B>, void> {
+  private:
+    using SegmentedArray = ::ttl::collections::SegmentedArray<T, B>;
+
+  public:
+    using Item = T;
+
+    static bool
+    is_empty(SegmentedArray const &self) {
+      return self.size == 0;
+    }
+
+    template <typename... Args>
+    static void
+    emplace(SegmentedArray &self, Args &&... args) {
+      if (self.size == self.capacity())
+        self.grow();
+
+      new (self.get_ptr(self.size)) T(::std::forward<Args>(args)...);
+      self.size += 1;
+    }
+
+    static void
+    push(SegmentedArray &self, T &&item) {
+      emplace(self, ::std::move(item));
+    }
+
+    static T
+    pop(SegmentedArray &self) {
+      CHECK(self.size > 0);
+
+      T *ptr = self.get_ptr(--self.size);
+      T item(::std::move(*ptr));
+      ptr->~T();
+      self.trim();
+      return item;
+    }
+
+    static void
+    pop_into(SegmentedArray &self, T &item) {
+      CHECK(self.size > 0);
+
+      T *ptr = self.get_ptr(--self.size);
+      item = ::std::move(*ptr);
+      ptr->~T();
+      self.trim();
+    }
+
+    static void
+    drop(SegmentedArray &self) {
+      CHECK(self.size > 0);
+
+      self.get_ptr(--self.size)->~T();
+      self.trim();
+    }
+
+    static void
+    clear(SegmentedArray &self) {
+      self.destroy_all();
+      self.trim();
+    }
+  };
+}
+
+#ifdef TTL_ENABLE_TEST
+namespace collections {
+  namespace segarray {
+    namespace {
+      using ::ttl::test::test_stack_destruction;
+      using ::ttl::test::test_stack;
+      using ::ttl::test::test_stack_emplace;
+      using ::ttl::test::test_stack_pop_into;
+      using ::ttl::test::test_stack_clear;
+      using ::ttl::test::AssertionFailure;
+      using ::ttl::traits::List;
+      using ::ttl::traits::ListMut;
+
+      template <typename T> using SmallSegmentedArray = SegmentedArray<T, 1>;
+
+      TESTCASE("test segmented array") {
+        SECTION("destruction") {
+          test_stack_destruction<SmallSegmentedArray>({});
+        }
+
+        SECTION("stack") {
+          test_stack<SmallSegmentedArray>({});
+          test_stack_emplace<SmallSegmentedArray>({});
+          test_stack_pop_into<SmallSegmentedArray>({});
+          test_stack_clear<SmallSegmentedArray>({});
+        }
+
+        SECTION("segments") {
+          ASSERT(SmallSegmentedArray<int>::segment(0) == 0);
+          ASSERT(SmallSegmentedArray<int>::segment(1) == 0);
+          ASSERT(SmallSegmentedArray<int>::segment(2) == 1);
+          ASSERT(SmallSegmentedArray<int>::segment(5) == 1);
+          ASSERT(SmallSegmentedArray<int>::segment(6) == 2);
+          ASSERT(SmallSegmentedArray<int>::segment_base(3) == 14);
+          ASSERT(SegmentedArray<int>::segment(15) == 0);
+          ASSERT(SegmentedArray<int>::segment(16) == 1);
+        }
+
+        SECTION("list") {
+          SmallSegmentedArray<::std::size_t> a;
+          for (::std::size_t i = 0; i < 1000; i++)
+            Stack::push(a, ::std::move(i));
+
+          for (::std::size_t i = 0; i < 1000; i++)
+            ASSERT(List::get(a, i) == i);
+          ASSERT_THROW(AssertionFailure, List::get(a, 1000));
+        }
+
+        SECTION("stable addresses") {
+          SmallSegmentedArray<::std::size_t> a;
+          Stack::push(a, 0);
+          ::std::size_t *first = &ListMut::get(a, 0);
+
+          for (::std::size_t i = 1; i < 10000; i++)
+            Stack::push(a, ::std::move(i));
+
+          ASSERT(first == &ListMut::get(a, 0));
+          ASSERT(*first == 0);
+        }
+
+        SECTION("shrink") {
+          SmallSegmentedArray<::std::size_t> a;
+          for (::std::size_t i = 0; i < 14; i++)
+            Stack::push(a, ::std::move(i));
+          ASSERT(a.segments == 3);
+          ASSERT(a.capacity() == 14);
+
+          Stack::push(a, 14);
+          ASSERT(a.segments == 4);
+
+          Stack::pop(a);
+          Stack::pop(a);
+          ASSERT(a.segments == 4);
+
+          while (a.size > 5)
+            Stack::pop(a);
+          ASSERT(a.segments == 3);
+
+          Stack::clear(a);
+          ASSERT(a.segments == 1);
+        }
+      }
+    }
+  }
+}
+#endif
+
+#ifdef TTL_ENABLE_BENCH
+namespace collections {
+  namespace segarray {
+    namespace {
+      using ::ttl::test::compare::Small;
+      using ::ttl::test::compare::Large;
+      using ::ttl::test::compare::bench_push_pop;
+      using ::ttl::test::compare::bench_get;
+      using ::ttl::test::compare::bench_push_latency;
+
+      BENCHMARK_RANGE("segarray/push_pop/small", 10, 100000000) {
+        bench_push_pop<Small>(bench, SegmentedArray<Small>());
+      }
+
+      BENCHMARK_RANGE("segarray/push_pop/large", 10, 100000000) {
+        bench_push_pop<Large>(bench, SegmentedArray<Large>());
+      }
+
+      BENCHMARK_RANGE("segarray/get/small", 10, 100000000) {
+        bench_get<Small>(bench, SegmentedArray<Small>());
+      }
+
+      BENCHMARK_RANGE("segarray/get/large", 10, 100000000) {
+        bench_get<Large>(bench, SegmentedArray<Large>());
+      }
+
+      BENCHMARK_RANGE("segarray/push_latency/small", 1000, 100000000) {
+        bench_push_latency<Small>(bench, SegmentedArray<Small>());
+      }
+
+      BENCHMARK_RANGE("segarray/push_latency/large", 1000, 100000000) {
+        bench_push_latency<Large>(bench, SegmentedArray<Large>());
+      }
+    }
+  }
+}
+#endif
@@ -0,0 +1,409 @@
+namespace collections {
+  namespace slotmap {
+    using ::ttl::storage::Chunk;
+    using ::ttl::storage::NIL_INDEX;
+
+    struct Handle {
+      ::std::uint32_t index;
+      ::std::uint32_t generation;
+    };
+
+    struct Slot {
+      ::std::uint32_t generation;
+      ::std::uint32_t index;
+    };
+
+    template <typename T, typename = void> struct SlotMap;
+
+    template <typename T>
+    struct SlotMap<
+        T, typename ::std::enable_if<::std::is_nothrow_move_constructible<
+               T>::value && ::std::is_nothrow_destructible<T>::value>::type> {
+      using Item = T;
+
+      ::std::uint32_t capacity;
+      ::std::uint32_t size;
+      ::std::uint32_t next;
+      ::std::uint32_t empty;
+      Chunk<Slot> slots;
+      Chunk<::std::uint32_t> owners;
+      Chunk<T> values;
+
+      SlotMap(::std::size_t capacity)
+          : capacity(capacity)
+          , size(0)
+          , next(0)
+          , empty(NIL_INDEX)
+          , slots(capacity)
+          , owners(capacity)
+          , values(capacity) {
+        CHECK(capacity < NIL_INDEX);
+      }
+
+      SlotMap(SlotMap &&o) noexcept : capacity(0),
+                                      size(0),
+                                      next(0),
+                                      empty(NIL_INDEX),
+                                      slots(::std::move(o.slots)),
+                                      owners(::std::move(o.owners)),
+                                      values(::std::move(o.values)) {
+        ::std::swap(capacity, o.capacity);
+        ::std::swap(size, o.size);
+        ::std::swap(next, o.next);
+        ::std::swap(empty, o.empty);
+      }
+
+      ~SlotMap() {
+        values.destroy_n(size);
+      }
+    };
+
+    template <typename T>
+    T *
+    get(SlotMap<T> &self, Handle handle) {
+      if ((handle.index >= self.next) ||
+          (self.slots.get(handle.index).generation != handle.generation))
+        return nullptr;
+      return self.values.get_ptr(self.slots.get(handle.index).index);
+    }
+
+    template <typename T>
+    T const *
+    get(SlotMap<T> const &self, Handle handle) {
+      if ((handle.index >= self.next) ||
+          (self.slots.get(handle.index).generation != handle.generation))
+        return nullptr;
+      return self.values.get_ptr(self.slots.get(handle.index).index);
+    }
+
+    template <typename T>
+    bool
+    contains(SlotMap<T> const &self, Handle handle) {
+      return get(self, handle) != nullptr;
+    }
+
+    template <typename T>
+    Handle
+    handle_at(SlotMap<T> const &self, ::std::size_t position) {
+      CHECK(position < self.size);
+      ::std::uint32_t index = self.owners.get(position);
+      return {index, self.slots.get(index).generation};
+    }
+
+    template <typename T, typename... Args>
+    Handle
+    emplace(SlotMap<T> &self, Args &&... args) {
+      CHECK(self.size < self.capacity);
+
+      ::std::uint32_t index;
+      if (self.empty != NIL_INDEX) {
+        index = self.empty;
+        self.empty = self.slots.get(index).index;
+      } else {
+        index = self.next++;
+        self.slots.get(index).generation = 0;
+      }
+
+      Slot &slot = self.slots.get(index);
+      self.values.emplace(self.size, ::std::forward<Args>(args)...);
+      self.owners.get(self.size) = index;
+      slot.index = self.size++;
+      slot.generation += 1;
+      return {index, slot.generation};
+    }
+
+    template <typename T>
+    Handle
+    insert(SlotMap<T> &self, typename SlotMap<T>::Item &&item) {
+      return emplace(self, ::std::move(item));
+    }
+
+    template <typename T>
+    bool
+    erase(SlotMap<T> &self, Handle handle) {
+      if (not contains(self, handle))
+        return false;
+
+      Slot &slot = self.slots.get(handle.index);
+      ::std::uint32_t position = slot.index;
+      ::std::uint32_t last = --self.size;
+
+      self.values.destroy(position);
+      if (position != last) {
+        self.values.write(position, self.values.read(last));
+        ::std::uint32_t owner = self.owners.get(last);
+        self.owners.get(position) = owner;
+        self.slots.get(owner).index = position;
+      }
+
+      slot.generation += 1;
+      slot.index = self.empty;
+      self.empty = handle.index;
+      return true;
+    }
+
+    template <typename T>
+    void
+    clear(SlotMap<T> &self) {
+      for (::std::uint32_t position = 0; position < self.size; ++position) {
+        ::std::uint32_t index = self.owners.get(position);
+        Slot &slot = self.slots.get(index);
+        slot.generation += 1;
+        slot.index = self.empty;
+        self.empty = index;
+      }
+      self.values.destroy_n(self.size);
+      self.size = 0;
+    }
+  }
+
+  using slotmap::SlotMap;
+}
+
+namespace traits {
+
+  template <typename T>
+  struct Collection::Impl<::ttl::collections::SlotMap<T>, void> {
+  private:
+    using SlotMap = ::ttl::collections::SlotMap<T>;
+
+  public:
+    static ::std::size_t
+    size(SlotMap const &self) {
+      return self.size;
+    }
+  };
+
+  template <typename T>
+  struct Bounded::Impl<::ttl::collections::SlotMap<T>, void> {
+  private:
+    using SlotMap = ::ttl::collections::SlotMap<T>;
+
+  public:
+    static ::std::size_t
+    capacity(SlotMap const &self) {
+      return self.capacity;
+    }
+  };
+
+  template <typename T>
+  struct Contiguous::Impl<::ttl::collections::SlotMap<T>, void> {
+  private:
+    using SlotMap = ::ttl::collections::SlotMap<T>;
+
+  public:
+    using Item = T;
+
+    static T *
+    data(SlotMap &self) {
+      return self.values.data;
+    }
+  };
+}
+
+#ifdef TTL_ENABLE_TEST
+namespace collections {
+  namespace slotmap {
+    namespace {
+      using ::ttl::test::AssertionFailure;
+      using ::ttl::test::Counter;
+      using ::ttl::traits::Collection;
+      using ::ttl::traits::Contiguous;
+
+      TESTCASE("test slotmap") {
+        SlotMap<::std::uint64_t> map(4);
+
+        SECTION("lookup") {
+          Handle a = insert(map, 10);
+          Handle b = insert(map, 20);
+          ASSERT(*get(map, a) == 10);
+          ASSERT(*get(map, b) == 20);
+          ASSERT(get(map, Handle{0, 0}) == nullptr);
+          ASSERT(get(map, Handle{3, 1}) == nullptr);
+
+          *get(map, a) = 11;
+          SlotMap<::std::uint64_t> const &view = map;
+          ASSERT(*get(view, a) == 11);
+        }
+
+        SECTION("stale") {
+          Handle a = insert(map, 10);
+          ASSERT(erase(map, a));
+          ASSERT(not erase(map, a));
+          ASSERT(not contains(map, a));
+
+          Handle b = insert(map, 30);
+          ASSERT(b.index == a.index);
+          ASSERT(b.generation != a.generation);
+          ASSERT(get(map, a) == nullptr);
+          ASSERT(*get(map, b) == 30);
+        }
+
+        SECTION("dense") {
+          Handle h[4];
+          for (::std::uint64_t i = 0; i < 4; ++i)
+            h[i] = insert(map, ::std::move(i));
+          ASSERT_THROW(AssertionFailure, insert(map, 4));
+
+          ASSERT(erase(map, h[1]));
+          ASSERT(Collection::size(map) == 3);
+          ::std::uint64_t *data = Contiguous::data(map);
+          ASSERT(data[0] == 0);
+          ASSERT(data[1] == 3);
+          ASSERT(data[2] == 2);
+          ASSERT(*get(map, h[3]) == 3);
+          ASSERT(handle_at(map, 1).index == h[3].index);
+          ASSERT(handle_at(map, 1).generation == h[3].generation);
+
+          ASSERT(erase(map, h[2]));
+          ASSERT(erase(map, h[0]));
+          ASSERT(Collection::size(map) == 1);
+          ASSERT(Contiguous::data(map)[0] == 3);
+          ASSERT(*get(map, h[3]) == 3);
+        }
+
+        SECTION("clear") {
+          Handle a = insert(map, 1);
+          insert(map, 2);
+          clear(map);
+          ASSERT(Collection::size(map) == 0);
+          ASSERT(not contains(map, a));
+          for (::std::uint64_t i = 0; i < 4; ++i)
+            insert(map, ::std::move(i));
+          ASSERT(map.next == 4);
+        }
+
+        SECTION("destruction") {
+          Counter::count = 0;
+          {
+            SlotMap<Counter> counters(4);
+            Handle a = emplace(counters);
+            emplace(counters);
+            emplace(counters);
+            ASSERT(erase(counters, a));
+            ASSERT(Counter::count == 1);
+            for (::std::size_t i = 0; i < 2; ++i)
+              ASSERT(Contiguous::data(counters)[i].valid);
+          }
+          ASSERT(Counter::count == 3);
+        }
+      }
+    }
+  }
+}
+#endif
+
+#ifdef TTL_ENABLE_BENCH
+namespace collections {
+  namespace slotmap {
+    namespace {
+      using ::ttl::storage::Pool;
+      using ::ttl::test::Bench;
+      using ::ttl::test::Random;
+      using ::ttl::test::do_not_optimize;
+      using ::ttl::traits::Allocator;
+      using ::ttl::traits::Collection;
+      using ::ttl::traits::Contiguous;
+
+      struct Particle {
+        double x, y, vx, vy;
+      };
+
+      template <typename H, typename I, typename E>
+      void
+      churn(::std::vector<H> &live, ::std::size_t n, I insert, E erase) {
+        Random random;
+        for (::std::size_t i = 0; i < n; ++i)
+          live.push_back(insert(double(i)));
+        for (::std::size_t i = 0; i < n / 2; ++i) {
+          ::std::size_t j = random.next() % live.size();
+          erase(live[j]);
+          live[j] = live.back();
+          live.pop_back();
+        }
+        while (live.size() < n)
+          live.push_back(insert(double(live.size())));
+        for (::std::size_t i = live.size(); i > 1; --i)
+          ::std::swap(live[i - 1], live[random.next() % i]);
+      }
+
+      void
+      churn_slotmap(SlotMap<Particle> &map, ::std::vector<Handle> &live,
+                    ::std::size_t n) {
+        churn(
+            live, n,
+            [&map](double v) { return insert(map, {v, v, 1, 1}); },
+            [&map](Handle h) { erase(map, h); });
+      }
+
+      void
+      churn_pool(Pool<Particle> &pool, ::std::vector<Particle *> &live,
+                 ::std::size_t n) {
+        churn(
+            live, n,
+            [&pool](double v) {
+              return Allocator::add(pool, {v, v, 1, 1});
+            },
+            [&pool](Particle *p) { Allocator::destroy(pool, p); });
+      }
+
+      BENCHMARK_RANGE("slotmap/iterate", 1000, 1000000) {
+        SlotMap<Particle> map(bench.arg);
+        ::std::vector<Handle> live;
+        churn_slotmap(map, live, bench.arg);
+        bench.ops = bench.arg;
+
+        for (::std::size_t i : bench) {
+          Particle *data = Contiguous::data(map);
+          for (::std::size_t j = 0; j < Collection::size(map); ++j)
+            data[j].x += data[j].vx;
+          do_not_optimize(data[i % bench.arg].x);
+        }
+      }
+
+      BENCHMARK_RANGE("slotmap/pool/iterate", 1000, 1000000) {
+        Pool<Particle> pool(bench.arg + bench.arg / 2);
+        ::std::vector<Particle *> live;
+        churn_pool(pool, live, bench.arg);
+        bench.ops = bench.arg;
+
+        for (::std::size_t i : bench) {
+          for (Particle *p : live)
+            p->x += p->vx;
+          do_not_optimize(live[i % bench.arg]->x);
+        }
+      }
+
+      BENCHMARK_RANGE("slotmap/lookup", 1000, 1000000) {
+        SlotMap<Particle> map(bench.arg);
+        ::std::vector<Handle> live;
+        churn_slotmap(map, live, bench.arg);
+        bench.ops = bench.arg;
+
+        for (::std::size_t i : bench) {
+          double sum = 0;
+          for (Handle h : live)
+            sum += get(map, h)->x;
+          do_not_optimize(sum);
+          do_not_optimize(i);
+        }
+      }
+
+      BENCHMARK_RANGE("slotmap/pool/lookup", 1000, 1000000) {
+        Pool<Particle> pool(bench.arg + bench.arg / 2);
+        ::std::vector<Particle *> live;
+        churn_pool(pool, live, bench.arg);
+        bench.ops = bench.arg;
+
+        for (::std::size_t i : bench) {
+          double sum = 0;
+          for (Particle *p : live)
+            sum += p->x;
+          do_not_optimize(sum);
+          do_not_optimize(i);
+        }
+      }
+    }
+  }
+}
+#endif
@@ -0,0 +1,787 @@
+namespace format {
+  namespace engine {
+    static constexpr ::std::size_t UNBOUNDED = ::std::size_t(-1);
+
+    static constexpr char DIGITS[] =
+        "000102030405060708091011121314151617181920212223242526272829"
+        "303132333435363738394041424344454647484950515253545556575859"
+        "606162636465666768697071727374757677787980818283848586878889"
+        "90919293949596979899";
+
+    enum class Kind { END, TEXT, FIELD, INVALID };
+
+    enum class Category { INTEGER, CHARACTER, CSTRING, POINTER, FLOAT };
+
+    struct Token {
+      Kind kind;
+      ::std::size_t begin, end, next;
+      bool left, plus, space, zero, alt;
+      ::std::size_t width;
+      bool has_precision;
+      ::std::size_t precision;
+      char length;
+      ::std::size_t bits;
+      char conversion;
+    };
+
+    constexpr bool
+    is_digit(char c) {
+      return (c >= '0') && (c <= '9');
+    }
+
+    constexpr bool
+    is_length(char c) {
+      return (c == 'h') || (c == 'l') || (c == 'z') || (c == 't') ||
+             (c == 'j');
+    }
+
+    constexpr Token
+    conversion(Token t, ::std::size_t next, char c) {
+      t.conversion = c;
+      t.end = t.next = next;
+
+      switch (t.conversion) {
+      case 'd':
+      case 'i':
+      case 'u':
+      case 'x':
+      case 'X':
+        t.kind = Kind::FIELD;
+        break;
+      case 'c':
+      case 's':
+      case 'p':
+      case 'f':
+      case 'F':
+      case 'e':
+      case 'E':
+      case 'g':
+      case 'G':
+        t.kind = ((t.length == 0) && (t.bits == 0)) ? Kind::FIELD
+                                                    : Kind::INVALID;
+        break;
+      default:
+        t.kind = Kind::INVALID;
+        break;
+      }
+
+      return t;
+    }
+
+    constexpr Token
+    parse(char const *s, ::std::size_t pos) {
+      Token t{};
+      t.begin = pos;
+
+      if (s[pos] == 0) {
+        t.kind = Kind::END;
+        return t;
+      }
+
+      if ((s[pos] == '`') && (s[pos + 1] == '`')) {
+        t.kind = Kind::TEXT;
+        t.end = pos + 1;
+        t.next = pos + 2;
+        return t;
+      }
+
+      if (s[pos] != '%') {
+        ++pos;
+        while ((s[pos] != 0) && (s[pos] != '%') && (s[pos] != '`'))
+          ++pos;
+        t.kind = Kind::TEXT;
+        t.end = t.next = pos;
+        return t;
+      }
+
+      if (s[pos + 1] == '%') {
+        t.kind = Kind::TEXT;
+        t.begin = pos + 1;
+        t.end = t.next = pos + 2;
+        return t;
+      }
+
+      for (++pos;; ++pos) {
+        if (s[pos] == '-')
+          t.left = true;
+        else if (s[pos] == '+')
+          t.plus = true;
+        else if (s[pos] == ' ')
+          t.space = true;
+        else if (s[pos] == '0')
+          t.zero = true;
+        else if (s[pos] == '#')
+          t.alt = true;
+        else
+          break;
+      }
+
+      for (; is_digit(s[pos]); ++pos)
+        t.width = t.width * 10 + ::std::size_t(s[pos] - '0');
+
+      if (s[pos] == '.') {
+        t.has_precision = true;
+        for (++pos; is_digit(s[pos]); ++pos)
+          t.precision = t.precision * 10 + ::std::size_t(s[pos] - '0');
+      }
+
+      if (s[pos] == '`') {
+        ++pos;
+        if (s[pos] == '8') {
+          t.bits = 8;
+          pos += 1;
+        } else if ((s[pos] == '1') && (s[pos + 1] == '6')) {
+          t.bits = 16;
+          pos += 2;
+        } else if ((s[pos] == '3') && (s[pos + 1] == '2')) {
+          t.bits = 32;
+          pos += 2;
+        } else if ((s[pos] == '6') && (s[pos + 1] == '4')) {
+          t.bits = 64;
+          pos += 2;
+        } else if (s[pos] == 'z') {
+          t.length = s[pos++];
+          if ((s[pos] != 'u') && (s[pos] != 'd'))
+            return conversion(t, pos, 'u');
+        } else if (s[pos] == 't') {
+          t.length = s[pos++];
+          return conversion(t, pos, 'd');
+        } else {
+          t.kind = Kind::INVALID;
+          return t;
+        }
+      } else if (is_length(s[pos])) {
+        t.length = s[pos++];
+        if ((s[pos] == t.length) && ((s[pos] == 'h') || (s[pos] == 'l'))) {
+          t.length = (s[pos] == 'h') ? 'H' : 'L';
+          ++pos;
+        }
+      }
+
+      return conversion(t, pos + 1, s[pos]);
+    }
+
+    template <typename S>
+    constexpr Token
+    token(::std::size_t pos) {
+      return parse(S{}.s, pos);
+    }
+
+    constexpr Category
+    category(Token const &t) {
+      return (t.conversion == 'c')   ? Category::CHARACTER
+             : (t.conversion == 's') ? Category::CSTRING
+             : (t.conversion == 'p') ? Category::POINTER
+             : ((t.conversion == 'd') || (t.conversion == 'i') ||
+                (t.conversion == 'u') || (t.conversion == 'x') ||
+                (t.conversion == 'X'))
+                 ? Category::INTEGER
+                 : Category::FLOAT;
+    }
+
+    constexpr bool
+    is_signed(Token const &t) {
+      return (t.conversion == 'd') || (t.conversion == 'i');
+    }
+
+    constexpr bool
+    is_hex(Token const &t) {
+      return (t.conversion == 'x') || (t.conversion == 'X');
+    }
+
+    constexpr ::std::size_t
+    integer_size(Token const &t) {
+      return (t.bits != 0)         ? t.bits / 8
+             : (t.length == 'H')   ? sizeof(char)
+             : (t.length == 'h')   ? sizeof(short)
+             : (t.length == 'l')   ? sizeof(long)
+             : (t.length == 'L')   ? sizeof(long long)
+             : (t.length == 'z')   ? sizeof(::std::size_t)
+             : (t.length == 't')   ? sizeof(::std::ptrdiff_t)
+             : (t.length == 'j')   ? sizeof(::std::intmax_t)
+                                   : sizeof(int);
+    }
+
+    constexpr ::std::size_t
+    decimal_digits(::std::size_t size) {
+      return (size == 1) ? 3 : (size == 2) ? 5 : (size == 4) ? 10 : 20;
+    }
+
+    constexpr ::std::size_t
+    max_length(Token const &t) {
+      ::std::size_t n =
+          (category(t) == Category::CHARACTER) ? 1
+          : (category(t) == Category::POINTER) ? 2 + 2 * sizeof(void *)
+          : (category(t) == Category::CSTRING)
+              ? (t.has_precision ? t.precision : UNBOUNDED)
+          : (category(t) == Category::FLOAT) ? UNBOUNDED
+          : is_hex(t)
+              ? (t.alt ? 2 : 0) + ::std::max(2 * integer_size(t), t.precision)
+              : (is_signed(t) ? 1 : 0) +
+                    ::std::max(decimal_digits(integer_size(t)), t.precision);
+      return ::std::max(n, t.width);
+    }
+
+    constexpr ::std::size_t
+    add(::std::size_t a, ::std::size_t b) {
+      return ((a == UNBOUNDED) || (b == UNBOUNDED)) ? UNBOUNDED : a + b;
+    }
+
+    template <typename T>
+    constexpr bool
+    accepts(Token const &t) {
+      return (category(t) == Category::INTEGER)
+                 ? (::std::is_integral<T>::value &&
+                    not ::std::is_same<T, bool>::value &&
+                    (::std::is_signed<T>::value == is_signed(t)) &&
+                    (sizeof(T) <= integer_size(t)))
+             : (category(t) == Category::CHARACTER)
+                 ? ::std::is_same<T, char>::value
+             : (category(t) == Category::CSTRING)
+                 ? ::std::is_convertible<T const &, char const *>::value
+             : (category(t) == Category::POINTER)
+                 ? ::std::is_convertible<T const &, void const *>::value
+                 : (::std::is_floating_point<T>::value &&
+                    not ::std::is_same<T, long double>::value);
+    }
+
+    inline char *
+    decimal(char *end, ::std::uint64_t value) {
+      while (value >= 100) {
+        ::std::size_t i = ::std::size_t(value % 100) * 2;
+        value /= 100;
+        end -= 2;
+        end[0] = DIGITS[i];
+        end[1] = DIGITS[i + 1];
+      }
+
+      if (value >= 10) {
+        end -= 2;
+        end[0] = DIGITS[value * 2];
+        end[1] = DIGITS[value * 2 + 1];
+      } else {
+        *--end = char('0' + value);
+      }
+      return end;
+    }
+
+    inline char *
+    hexadecimal(char *end, ::std::uint64_t value, bool upper) {
+      char const *digits = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+      do {
+        *--end = digits[value & 15];
+        value >>= 4;
+      } while (value != 0);
+      return end;
+    }
+
+    struct Writer {
+      char *cursor;
+      char *limit;
+      ::std::size_t length;
+
+      void
+      put(char const *s, ::std::size_t n) {
+        ::std::size_t room = ::std::size_t(limit - cursor);
+        __builtin_memcpy(cursor, s, (n < room) ? n : room);
+        cursor += (n < room) ? n : room;
+        length += n;
+      }
+
+      void
+      fill(char c, ::std::size_t n) {
+        ::std::size_t room = ::std::size_t(limit - cursor);
+        __builtin_memset(cursor, c, (n < room) ? n : room);
+        cursor += (n < room) ? n : room;
+        length += n;
+      }
+    };
+
+    inline void
+    put_padded(Writer &w, Token const &t, char const *s, ::std::size_t n) {
+      ::std::size_t pad = (t.width > n) ? t.width - n : 0;
+      if (not t.left)
+        w.fill(' ', pad);
+      w.put(s, n);
+      if (t.left)
+        w.fill(' ', pad);
+    }
+
+    inline void
+    put_integer(Writer &w, Token const &t, bool negative,
+                ::std::uint64_t magnitude) {
+      char buffer[24];
+      char *end = buffer + sizeof(buffer);
+      char *begin = end;
+
+      if (not(t.has_precision && (t.precision == 0) && (magnitude == 0)))
+        begin = is_hex(t) ? hexadecimal(end, magnitude, t.conversion == 'X')
+                          : decimal(end, magnitude);
+
+      char prefix[2];
+      ::std::size_t nprefix = 0;
+      if (negative)
+        prefix[nprefix++] = '-';
+      else if (is_signed(t) && t.plus)
+        prefix[nprefix++] = '+';
+      else if (is_signed(t) && t.space)
+        prefix[nprefix++] = ' ';
+      else if (is_hex(t) && t.alt && (magnitude != 0)) {
+        prefix[nprefix++] = '0';
+        prefix[nprefix++] = t.conversion;
+      }
+
+      ::std::size_t digits = ::std::size_t(end - begin);
+      ::std::size_t zeros =
+          (t.precision > digits) ? t.precision - digits : 0;
+      ::std::size_t n = nprefix + zeros + digits;
+      ::std::size_t pad = (t.width > n) ? t.width - n : 0;
+      if (t.zero && not t.left && not t.has_precision) {
+        zeros += pad;
+        pad = 0;
+      }
+
+      if (not t.left)
+        w.fill(' ', pad);
+      w.put(prefix, nprefix);
+      w.fill('0', zeros);
+      w.put(begin, digits);
+      if (t.left)
+        w.fill(' ', pad);
+    }
+
+    template <Category C> using Tag = ::std::integral_constant<Category, C>;
+
+    template <typename T>
+    void
+    put(Writer &w, Token const &t, T value,
+        Tag<Category::INTEGER>) {
+      using U = typename ::std::make_unsigned<T>::type;
+      bool negative =
+          ::std::is_signed<T>::value && (U(value) >> (sizeof(T) * 8 - 1));
+      put_integer(w, t, negative, negative ? U(U(0) - U(value)) : U(value));
+    }
+
+    inline void
+    put(Writer &w, Token const &t, char c,
+        Tag<Category::CHARACTER>) {
+      put_padded(w, t, &c, 1);
+    }
+
+    inline void
+    put(Writer &w, Token const &t, char const *s,
+        Tag<Category::CSTRING>) {
+      if (s == nullptr)
+        s = "(null)";
+
+      ::std::size_t n = 0;
+      if (t.has_precision)
+        while ((n < t.precision) && (s[n] != 0))
+          ++n;
+      else
+        n = __builtin_strlen(s);
+      put_padded(w, t, s, n);
+    }
+
+    inline void
+    put(Writer &w, Token const &t, void const *p,
+        Tag<Category::POINTER>) {
+      if (p == nullptr)
+        return put_padded(w, t, "(nil)", 5);
+
+      Token hex = t;
+      hex.conversion = 'x';
+      hex.alt = true;
+      put_integer(w, hex, false, ::std::uintptr_t(p));
+    }
+
+    inline void
+    put(Writer &w, Token const &t, double value,
+        Tag<Category::FLOAT>) {
+      char spec[12];
+      ::std::size_t n = 0;
+      spec[n++] = '%';
+      if (t.left)
+        spec[n++] = '-';
+      if (t.plus)
+        spec[n++] = '+';
+      if (t.space)
+        spec[n++] = ' ';
+      if (t.zero)
+        spec[n++] = '0';
+      if (t.alt)
+        spec[n++] = '#';
+      spec[n++] = '*';
+      spec[n++] = '.';
+      spec[n++] = '*';
+      spec[n++] = t.conversion;
+      spec[n] = 0;
+
+      ::std::size_t room = ::std::size_t(w.limit - w.cursor);
+      int written = snprintf(w.cursor, room + 1, spec, int(t.width),
+                             t.has_precision ? int(t.precision) : -1, value);
+      if (written < 0)
+        return;
+      w.cursor += (::std::size_t(written) < room) ? written : room;
+      w.length += ::std::size_t(written);
+    }
+
+    template <typename, typename> struct RAW_STRING;
+
+    template <typename S, template <typename U, U...> typename T, typename U,
+              U... I>
+    struct RAW_STRING<S, T<U, I...>> {
+      using TYPE = STRING<S{}.s[I]...>;
+    };
+
+    template <typename S>
+    using TEXT_STRING = STRING_LITERAL<typename RAW_STRING<
+        S, ::std::make_index_sequence<sizeof(S) - 1>>::TYPE>;
+
+    template <typename...> struct Types {};
+
+    template <typename S, ::std::size_t POS = 0, Kind = token<S>(POS).kind>
+    struct Format;
+
+    template <typename S, ::std::size_t POS>
+    struct Format<S, POS, Kind::END> {
+      static constexpr ::std::size_t MAX = 0;
+
+      template <typename... Args>
+      static void
+      check(Types<Args...>) {
+        static_assert(sizeof...(Args) == 0,
+                      "too many arguments for format string");
+      }
+
+      template <typename... Args>
+      static void
+      write(Writer &, Args const &...) {
+      }
+
+      template <typename F, typename... Args>
+      static void
+      fields(F &, Args const &...) {
+      }
+    };
+
+    template <typename S, ::std::size_t POS>
+    struct Format<S, POS, Kind::INVALID> {
+      static_assert(sizeof(S) == 0, "invalid conversion in format string");
+    };
+
+    template <typename S, ::std::size_t POS>
+    struct Format<S, POS, Kind::TEXT> {
+      static constexpr Token TOKEN = token<S>(POS);
+      using Next = Format<S, TOKEN.next>;
+      static constexpr ::std::size_t MAX =
+          add(TOKEN.end - TOKEN.begin, Next::MAX);
+
+      template <typename... Args>
+      static void
+      check(Types<Args...> types) {
+        Next::check(types);
+      }
+
+      template <typename... Args>
+      static void
+      write(Writer &w, Args const &... args) {
+        w.put(TEXT_STRING<S>::s + TOKEN.begin, TOKEN.end - TOKEN.begin);
+        Next::write(w, args...);
+      }
+
+      template <typename F, typename... Args>
+      static void
+      fields(F &f, Args const &... args) {
+        Next::fields(f, args...);
+      }
+    };
+
+    template <typename S, ::std::size_t POS>
+    struct Format<S, POS, Kind::FIELD> {
+      static constexpr Token TOKEN = token<S>(POS);
+      using Next = Format<S, TOKEN.next>;
+      static constexpr ::std::size_t MAX = add(max_length(TOKEN), Next::MAX);
+
+      static void
+      check(Types<>) {
+        static_assert(sizeof(S) == 0, "too few arguments for format string");
+      }
+
+      template <typename Arg, typename... Args>
+      static void
+      check(Types<Arg, Args...>) {
+        static_assert(accepts<Arg>(TOKEN),
+                      "argument type does not match format string");
+        Next::check(Types<Args...>());
+      }
+
+      static void
+      write(Writer &) {
+      }
+
+      template <typename Arg, typename... Args>
+      static void
+      write(Writer &w, Arg const &arg, Args const &... args) {
+        put(w, TOKEN, arg, Tag<category(TOKEN)>());
+        Next::write(w, args...);
+      }
+
+      template <typename F>
+      static void
+      fields(F &) {
+      }
+
+      template <typename F, typename Arg, typename... Args>
+      static void
+      fields(F &f, Arg const &arg, Args const &... args) {
+        f(TOKEN, Tag<category(TOKEN)>(), arg);
+        Next::fields(f, args...);
+      }
+    };
+
+    template <typename S, ::std::size_t POS>
+    constexpr Token Format<S, POS, Kind::TEXT>::TOKEN;
+
+    template <typename S, ::std::size_t POS>
+    constexpr Token Format<S, POS, Kind::FIELD>::TOKEN;
+
+    template <::std::size_t N> struct Buffer {
+      char data[N];
+      ::std::size_t size;
+    };
+
+    template <typename S>
+    using BUFFER =
+        Buffer<(Format<S>::MAX == UNBOUNDED) ? 1 : Format<S>::MAX + 1>;
+
+    template <typename S, typename... Args>
+    ::std::size_t
+    format_to(char *buffer, ::std::size_t size, Args const &... args) {
+      char empty;
+      if (size == 0) {
+        buffer = &empty;
+        size = 1;
+      }
+
+      Format<S>::check(Types<Args...>());
+      Writer w{buffer, buffer + size - 1, 0};
+      Format<S>::write(w, args...);
+      *w.cursor = 0;
+      return w.length;
+    }
+
+    template <typename S, typename... Args>
+    BUFFER<S>
+    format_buffer(Args const &... args) {
+      static_assert(Format<S>::MAX != UNBOUNDED,
+                    "format string has no length bound, use FORMAT_TO");
+      Format<S>::check(Types<Args...>());
+      BUFFER<S> result;
+      Writer w{result.data, result.data + sizeof(result.data) - 1, 0};
+      Format<S>::write(w, args...);
+      *w.cursor = 0;
+      result.size = w.length;
+      return result;
+    }
+  }
+
+  using engine::Buffer;
+  using engine::format_to;
+  using engine::format_buffer;
+}
+
+#define FORMAT_TO(buffer, size, str, ...)                                      \
+  ({                                                                           \
+    struct S {                                                                 \
+      const char s[sizeof(str)] = (str);                                       \
+    };                                                                         \
+    ::ttl::format::format_to<S>((buffer), (size), ##__VA_ARGS__);              \
+  })
+
+#define FORMAT_BUFFER(str, ...)                                                \
+  ({                                                                           \
+    struct S {                                                                 \
+      const char s[sizeof(str)] = (str);                                       \
+    };                                                                         \
+    ::ttl::format::format_buffer<S>(__VA_ARGS__);                              \
+  })
+
+#ifdef TTL_ENABLE_TEST
+namespace format {
+  namespace engine {
+    namespace {
+#define ASSERT_FORMAT(str, ...)                                                \
+  do {                                                                         \
+    char actual[128], expected[128];                                           \
+    ::std::size_t n = FORMAT_TO(actual, sizeof(actual), str, __VA_ARGS__);     \
+    int m = snprintf(expected, sizeof(expected), FORMAT(str), __VA_ARGS__);    \
+    ASSERT(n == ::std::size_t(m));                                             \
+    ASSERT(strcmp(actual, expected) == 0);                                     \
+  } while (0)
+
+      TESTCASE("test format engine") {
+        SECTION("integers") {
+          ASSERT_FORMAT("%d|%u", 0, 0u);
+          ASSERT_FORMAT("%d|%i", -2147483647 - 1, 2147483647);
+          ASSERT_FORMAT("%`8u %`8d", ::std::uint8_t(255), ::std::int8_t(-128));
+          ASSERT_FORMAT("%`16u %`16d", ::std::uint16_t(65535),
+                        ::std::int16_t(-7));
+          ASSERT_FORMAT("%`32u %`32d", ::std::uint32_t(4294967295u),
+                        ::std::int32_t(-1));
+          ASSERT_FORMAT("%`64u %`64d", ::std::uint64_t(-1),
+                        ::std::int64_t(-9223372036854775807 - 1));
+          ASSERT_FORMAT("%`zu %`zd %`t %`z", ::std::size_t(12345),
+                        ::ssize_t(-12345), ::std::ptrdiff_t(-99),
+                        ::std::size_t(7));
+          ASSERT_FORMAT("%hhu %hd %ld %llu", (unsigned char)(200),
+                        short(-300), -1234567890123l, 1ull << 63);
+        }
+
+        SECTION("integer flags") {
+          ASSERT_FORMAT("[%5d][%-5d][%05d][%+d][% d]", 42, 42, -42, 42, 42);
+          ASSERT_FORMAT("[%.3d][%8.3d][%-8.3u]", 7, -7, 7u);
+          ASSERT_FORMAT("[%.0d][%5.0u][%+.0d]", 0, 0u, 0);
+          ASSERT_FORMAT("[%x][%X][%#x][%#010x][%#x]", 0xbeefu, 0xbeefu,
+                        0xbeefu, 0xbeefu, 0u);
+          ASSERT_FORMAT("[%`32u|%`32d]", ::std::uint16_t(7), short(-7));
+        }
+
+        SECTION("text") {
+          ASSERT_FORMAT("%s, %s!", "hello", "world");
+          ASSERT_FORMAT("[%10s][%-10s][%.3s][%6.2s]", "abc", "abc", "abcdef",
+                        "abcdef");
+          ASSERT_FORMAT("[%c][%3c][%-3c]", 'x', 'y', 'z');
+          ASSERT_FORMAT("100%% %s%%", "done");
+          ASSERT_FORMAT("``%d``", 1);
+          ASSERT_FORMAT("[%p][%20p]", (void *)0x1234, (void *)0xabcdef);
+        }
+
+        SECTION("floats") {
+          ASSERT_FORMAT("%f %e %g", 3.25, -1e-10, 1e100);
+          ASSERT_FORMAT("[%10.3f][%-10.2e][%+08.2f]", 3.14159, 2.5, 1.5f);
+        }
+
+        SECTION("no arguments") {
+          char buffer[8];
+          ASSERT(FORMAT_TO(buffer, sizeof(buffer), "abc") == 3);
+          ASSERT(strcmp(buffer, "abc") == 0);
+          ASSERT(FORMAT_TO(buffer, sizeof(buffer), "") == 0);
+          ASSERT(buffer[0] == 0);
+        }
+
+        SECTION("truncate") {
+          char buffer[8];
+          ASSERT(FORMAT_TO(buffer, sizeof(buffer), "%d-%s", 123456,
+                           "abcdef") == 13);
+          ASSERT(strcmp(buffer, "123456-") == 0);
+          ASSERT(FORMAT_TO(buffer, 4, "%f", 1.5) == 8);
+          ASSERT(strcmp(buffer, "1.5") == 0);
+          ASSERT(FORMAT_TO(nullptr, 0, "%`64u", ::std::uint64_t(1)) == 1);
+        }
+
+        SECTION("buffer") {
+          auto b = FORMAT_BUFFER("%`32u/%`32u", ::std::uint32_t(1),
+                                 ::std::uint32_t(4294967295u));
+          ASSERT(b.size == 12);
+          ASSERT(strcmp(b.data, "1/4294967295") == 0);
+          ASSERT(sizeof(b.data) == 22);
+
+          auto c = FORMAT_BUFFER("[%-30c]", 'c');
+          ASSERT(sizeof(c.data) == 33);
+          ASSERT(c.size == 32);
+
+          auto s = FORMAT_BUFFER("%.4s|%`64x", "abcdef", ::std::uint64_t(-1));
+          ASSERT(sizeof(s.data) == 22);
+          ASSERT(strcmp(s.data, "abcd|ffffffffffffffff") == 0);
+        }
+
+        SECTION("compile time") {
+          static_assert(accepts<int>(parse("%d", 0)), "");
+          static_assert(accepts<short>(parse("%d", 0)), "");
+          static_assert(not accepts<long long>(parse("%d", 0)), "");
+          static_assert(not accepts<unsigned>(parse("%d", 0)), "");
+          static_assert(not accepts<int>(parse("%`32u", 0)), "");
+          static_assert(not accepts<::std::uint64_t>(parse("%`32u", 0)), "");
+          static_assert(accepts<::std::size_t>(parse("%`zu", 0)), "");
+          static_assert(not accepts<bool>(parse("%u", 0)), "");
+          static_assert(not accepts<int>(parse("%s", 0)), "");
+          static_assert(accepts<char[4]>(parse("%s", 0)), "");
+          static_assert(not accepts<long double>(parse("%f", 0)), "");
+          static_assert(parse("%ls", 0).kind == Kind::INVALID, "");
+          static_assert(parse("%`17u", 0).kind == Kind::INVALID, "");
+          static_assert(parse("%*d", 0).kind == Kind::INVALID, "");
+          static_assert(parse("%", 0).kind == Kind::INVALID, "");
+        }
+      }
+
+#undef ASSERT_FORMAT
+    }
+  }
+}
+#endif
+
+#ifdef TTL_ENABLE_BENCH
+namespace format {
+  namespace engine {
+    namespace {
+      using ::ttl::test::Bench;
+      using ::ttl::test::Random;
+      using ::ttl::test::do_not_optimize;
+
+      template <typename F>
+      void
+      bench_format(Bench &bench, F format) {
+        char buffer[128];
+        Random random;
+        for (::std::size_t i : bench) {
+          ::std::uint64_t value = random.next() >> (i & 63);
+          do_not_optimize(format(buffer, sizeof(buffer), value));
+          do_not_optimize(buffer[0]);
+        }
+      }
+
+      BENCHMARK("format/engine/uint64") {
+        bench_format(bench,
+                     [](char *buffer, ::std::size_t size, ::std::uint64_t v) {
+                       return FORMAT_TO(buffer, size, "%`64u", v);
+                     });
+      }
+
+      BENCHMARK("format/snprintf/uint64") {
+        bench_format(bench,
+                     [](char *buffer, ::std::size_t size, ::std::uint64_t v) {
+                       return snprintf(buffer, size, FORMAT("%`64u"), v);
+                     });
+      }
+
+      BENCHMARK("format/engine/record") {
+        bench_format(bench, [](char *buffer, ::std::size_t size,
+                               ::std::uint64_t v) {
+          return FORMAT_TO(buffer, size, "id=%`64u size=%`32u name=%s tag=%x",
+                           v, ::std::uint32_t(v), "record",
+                           unsigned(v >> 32));
+        });
+      }
+
+      BENCHMARK("format/snprintf/record") {
+        bench_format(bench, [](char *buffer, ::std::size_t size,
+                               ::std::uint64_t v) {
+          return snprintf(buffer, size,
+                          FORMAT("id=%`64u size=%`32u name=%s tag=%x"), v,
+                          ::std::uint32_t(v), "record", unsigned(v >> 32));
+        });
+      }
+
+      BENCHMARK("format/engine/buffer") {
+        bench_format(bench, [](char *, ::std::size_t, ::std::uint64_t v) {
+          auto b = FORMAT_BUFFER("[%`64d] %08x", ::std::int64_t(v),
+                                 unsigned(v));
+          do_not_optimize(b.data[0]);
+          return b.size;
+        });
+      }
+    }
+  }
+}
+#endif
@@ -0,0 +1,2 @@
+#include <ttl/logging/ring.hpp>
+#include <ttl/logging/logger.hpp>
@@ -0,0 +1,792 @@
+namespace logging {
+  namespace logger {
+    using ::ttl::traits::ListMut;
+    using ::ttl::traits::Stack;
+    using ::ttl::traits::Unbounded;
+    using ::ttl::collections::Array;
+    using ::ttl::storage::Chunk;
+    using ::ttl::format::engine::Category;
+    using ::ttl::format::engine::Format;
+    using ::ttl::format::engine::Kind;
+    using ::ttl::format::engine::Tag;
+    using ::ttl::format::engine::TEXT_STRING;
+    using ::ttl::format::engine::Token;
+    using ::ttl::format::engine::Types;
+    using ::ttl::format::engine::Writer;
+    using ring::align;
+
+    static constexpr ::std::uint32_t DEFINITION = 0xffffffff;
+    static constexpr char MAGIC[8] = {'t', 't', 'l', 'l', 'o', 'g', '1', '\n'};
+
+    struct Site;
+
+    struct Registry {
+      ::std::atomic<Site const *> head;
+      ::std::atomic<::std::uint32_t> last;
+    };
+
+    inline Registry &
+    registry() {
+      static Registry registry{{nullptr}, {0}};
+      return registry;
+    }
+
+    struct Site {
+      char const *format;
+      ::std::uint32_t id;
+      Site const *next;
+
+      Site(Site const &) = delete;
+      Site &
+      operator=(Site const &) = delete;
+
+      Site(char const *format)
+          : format(format)
+          , id(registry().last.fetch_add(1) + 1)
+          , next(registry().head.load()) {
+        while (not registry().head.compare_exchange_weak(next, this))
+          ;
+      }
+    };
+
+    template <typename S>
+    Site const &
+    site() {
+      static Site const site(TEXT_STRING<S>::s);
+      return site;
+    }
+
+    inline ::std::uint64_t
+    now() {
+      return ::std::chrono::duration_cast<::std::chrono::nanoseconds>(
+                 ::std::chrono::steady_clock::now().time_since_epoch())
+          .count();
+    }
+
+    inline ::std::size_t
+    length(Token const &t, char const *s) {
+      if (s == nullptr)
+        s = "(null)";
+
+      ::std::size_t n = 0;
+      if (t.has_precision)
+        while ((n < t.precision) && (s[n] != 0))
+          ++n;
+      else
+        n = __builtin_strlen(s);
+      return n;
+    }
+
+    struct Measure {
+      ::std::size_t size;
+
+      template <Category C, typename T>
+      void
+      operator()(Token const &, Tag<C>, T const &) {
+        size += 8;
+      }
+
+      template <typename T>
+      void
+      operator()(Token const &t, Tag<Category::CSTRING>, T const &arg) {
+        size += 8 + align(length(t, arg));
+      }
+    };
+
+    struct Encode {
+      char *cursor;
+
+      void
+      store(::std::uint64_t value) {
+        __builtin_memcpy(cursor, &value, 8);
+        cursor += 8;
+      }
+
+      template <typename T>
+      void
+      operator()(Token const &, Tag<Category::INTEGER>, T const &arg) {
+        store(::std::uint64_t(arg));
+      }
+
+      void
+      operator()(Token const &, Tag<Category::CHARACTER>, char arg) {
+        store((unsigned char)arg);
+      }
+
+      template <typename T>
+      void
+      operator()(Token const &t, Tag<Category::CSTRING>, T const &arg) {
+        char const *s = arg;
+        ::std::size_t n = length(t, s);
+        store(n);
+        __builtin_memcpy(cursor, (s == nullptr) ? "(null)" : s, n);
+        cursor += align(n);
+      }
+
+      template <typename T>
+      void
+      operator()(Token const &, Tag<Category::POINTER>, T const &arg) {
+        store(::std::uintptr_t(static_cast<void const *>(arg)));
+      }
+
+      void
+      operator()(Token const &, Tag<Category::FLOAT>, double arg) {
+        __builtin_memcpy(cursor, &arg, 8);
+        cursor += 8;
+      }
+    };
+
+    struct Logger {
+      ::std::size_t capacity;
+      ::std::mutex mutex;
+      Ring *rings;
+      Array<Site const *> sites;
+
+      Logger(Logger const &) = delete;
+      Logger &
+      operator=(Logger const &) = delete;
+
+      Logger(::std::size_t capacity)
+          : capacity(capacity)
+          , mutex()
+          , rings(nullptr)
+          , sites(0) {
+      }
+
+      Ring *
+      attach() {
+        Ring *ring = new Ring(capacity);
+        ::std::lock_guard<::std::mutex> guard(mutex);
+        ring->next = rings;
+        rings = ring;
+        return ring;
+      }
+
+      Site const *
+      find(::std::uint32_t id) {
+        if ((id < sites.size) && (ListMut::get(sites, id) != nullptr))
+          return ListMut::get(sites, id);
+
+        for (Site const *s = registry().head.load(); s != nullptr;
+             s = s->next) {
+          while (sites.size <= s->id)
+            Stack::push(sites, nullptr);
+          ListMut::get(sites, s->id) = s;
+        }
+        return (id < sites.size) ? ListMut::get(sites, id) : nullptr;
+      }
+
+      template <typename F>
+      ::std::size_t
+      drain(F &sink) {
+        ::std::lock_guard<::std::mutex> guard(mutex);
+        ::std::size_t n = 0;
+
+        for (Ring **link = &rings; *link != nullptr;) {
+          Ring *ring = *link;
+          bool closed = ring->closed.load(::std::memory_order_acquire);
+
+          while (Header const *header = ring->peek()) {
+            sink(*find(header->site), *header);
+            ring->release(header);
+            n += 1;
+          }
+
+          if (closed) {
+            *link = ring->next;
+            delete ring;
+          } else {
+            link = &ring->next;
+          }
+        }
+        return n;
+      }
+
+      ::std::size_t
+      dropped() {
+        ::std::lock_guard<::std::mutex> guard(mutex);
+        ::std::size_t n = 0;
+        for (Ring *ring = rings; ring != nullptr; ring = ring->next)
+          n += ring->dropped.load(::std::memory_order_relaxed);
+        return n;
+      }
+
+      ~Logger() {
+        while (rings != nullptr) {
+          Ring *ring = rings;
+          rings = ring->next;
+          delete ring;
+        }
+      }
+    };
+
+    struct LogHandle {
+      Ring *ring;
+
+      LogHandle(LogHandle const &) = delete;
+      LogHandle &
+      operator=(LogHandle const &) = delete;
+
+      LogHandle(Logger &logger)
+          : ring(logger.attach()) {
+      }
+
+      ~LogHandle() {
+        ring->closed.store(true, ::std::memory_order_release);
+      }
+    };
+
+    template <typename S, typename... Args>
+    bool
+    log(LogHandle &handle, Args const &... args) {
+      Format<S>::check(Types<Args...>());
+
+      Measure measure{sizeof(Header)};
+      Format<S>::fields(measure, args...);
+      ::std::size_t size = align(measure.size);
+
+      char *ptr = handle.ring->reserve(size);
+      if (ptr == nullptr)
+        return false;
+
+      Header *header = reinterpret_cast<Header *>(ptr);
+      header->size = ::std::uint32_t(size);
+      header->site = site<S>().id;
+      header->time = now();
+
+      Encode encode{ptr + sizeof(Header)};
+      Format<S>::fields(encode, args...);
+      handle.ring->commit();
+      return true;
+    }
+
+    inline bool
+    decode_field(Writer &w, Token const &t, char const *&payload,
+                 char const *end) {
+      using ::ttl::format::engine::put;
+      using ::ttl::format::engine::put_padded;
+
+      ::std::uint64_t value;
+      if (end - payload < 8)
+        return false;
+      __builtin_memcpy(&value, payload, 8);
+      payload += 8;
+
+      switch (category(t)) {
+      case Category::INTEGER:
+        if (is_signed(t))
+          put(w, t, ::std::int64_t(value), Tag<Category::INTEGER>());
+        else
+          put(w, t, value, Tag<Category::INTEGER>());
+        return true;
+      case Category::CHARACTER:
+        put(w, t, char(value), Tag<Category::CHARACTER>());
+        return true;
+      case Category::CSTRING:
+        if ((value > ::std::size_t(end - payload)) ||
+            (::std::size_t(end - payload) < align(value)))
+          return false;
+        put_padded(w, t, payload, value);
+        payload += align(value);
+        return true;
+      case Category::POINTER:
+        put(w, t, reinterpret_cast<void const *>(::std::uintptr_t(value)),
+            Tag<Category::POINTER>());
+        return true;
+      case Category::FLOAT:
+        double d;
+        __builtin_memcpy(&d, &value, 8);
+        put(w, t, d, Tag<Category::FLOAT>());
+        return true;
+      }
+      return false;
+    }
+
+    inline bool
+    decode(Writer &w, char const *format, char const *payload,
+           ::std::size_t size) {
+      char const *end = payload + size;
+
+      for (::std::size_t pos = 0;;) {
+        Token t = ::ttl::format::engine::parse(format, pos);
+        pos = t.next;
+
+        switch (t.kind) {
+        case Kind::END:
+          return payload == end;
+        case Kind::INVALID:
+          return false;
+        case Kind::TEXT:
+          w.put(format + t.begin, t.end - t.begin);
+          break;
+        case Kind::FIELD:
+          if (not decode_field(w, t, payload, end))
+            return false;
+          break;
+        }
+      }
+    }
+
+    inline bool
+    format_record(Writer &w, char const *format, Header const &header) {
+      char digits[24];
+      char *begin = ::ttl::format::engine::decimal(digits + 24, header.time);
+      w.put(begin, ::std::size_t(digits + 24 - begin));
+      w.put(" ", 1);
+      return decode(w, format, reinterpret_cast<char const *>(&header + 1),
+                    header.size - sizeof(Header));
+    }
+
+    inline bool
+    write_record(FILE *file, char const *format, Header const &header) {
+      char line[1024];
+      char *buffer = line;
+      Writer w{line, line + sizeof(line) - 1, 0};
+      if (not format_record(w, format, header))
+        return false;
+
+      if (w.length >= sizeof(line)) {
+        buffer = static_cast<char *>(::std::malloc(w.length + 1));
+        if (buffer == nullptr)
+          return false;
+        w = Writer{buffer, buffer + w.length, 0};
+        format_record(w, format, header);
+      }
+
+      *w.cursor++ = '\n';
+      ::std::size_t n = ::std::size_t(w.cursor - buffer);
+      bool written = fwrite(buffer, 1, n, file) == n;
+      if (buffer != line)
+        ::std::free(buffer);
+      return written;
+    }
+
+    struct TextSink {
+      FILE *file;
+
+      void
+      operator()(Site const &site, Header const &header) {
+        write_record(file, site.format, header);
+      }
+    };
+
+    struct FileSink {
+      FILE *file;
+      Array<bool> defined;
+
+      FileSink(FILE *file)
+          : file(file)
+          , defined(0) {
+        fwrite(MAGIC, 1, sizeof(MAGIC), file);
+      }
+
+      void
+      define(Site const &site) {
+        while (defined.size <= site.id)
+          Stack::push(defined, false);
+        if (ListMut::get(defined, site.id))
+          return;
+        ListMut::get(defined, site.id) = true;
+
+        ::std::size_t n = __builtin_strlen(site.format) + 1;
+        Header header{::std::uint32_t(sizeof(Header) + align(n)), DEFINITION,
+                      site.id};
+        ::std::uint64_t zero = 0;
+        fwrite(&header, sizeof(header), 1, file);
+        fwrite(site.format, 1, n, file);
+        fwrite(&zero, 1, align(n) - n, file);
+      }
+
+      void
+      operator()(Site const &site, Header const &header) {
+        define(site);
+        fwrite(&header, 1, header.size, file);
+      }
+    };
+
+    inline bool
+    decode_file(FILE *in, FILE *out) {
+      char magic[sizeof(MAGIC)];
+      if ((fread(magic, 1, sizeof(magic), in) != sizeof(magic)) ||
+          (__builtin_memcmp(magic, MAGIC, sizeof(MAGIC)) != 0))
+        return false;
+
+      Chunk<::std::uint64_t> record(64);
+      Array<char> text(0);
+      Array<::std::size_t> offsets(0);
+      Header header;
+
+      while (fread(&header, sizeof(header), 1, in) == 1) {
+        if ((header.size < sizeof(Header)) ||
+            (header.size != align(header.size)))
+          return false;
+        if (record.capacity * 8 < header.size)
+          record.resize(header.size / 8);
+
+        char *payload = reinterpret_cast<char *>(record.data);
+        __builtin_memcpy(payload, &header, sizeof(header));
+        ::std::size_t n = header.size - sizeof(Header);
+        if (fread(payload + sizeof(Header), 1, n, in) != n)
+          return false;
+
+        if (header.site == DEFINITION) {
+          if ((n == 0) || (payload[sizeof(Header) + n - 1] != 0) ||
+              (header.time > ::std::uint32_t(-1)))
+            return false;
+          if (offsets.size <= header.time) {
+            try {
+              Unbounded::reserve(offsets, ::std::size_t(header.time) + 1);
+            } catch (::std::bad_alloc const &) {
+              return false;
+            }
+          }
+          while (offsets.size <= header.time)
+            Stack::push(offsets, ::std::size_t(-1));
+          ListMut::get(offsets, header.time) = text.size;
+          for (::std::size_t i = 0; i < n; ++i)
+            Stack::push(text, char(payload[sizeof(Header) + i]));
+          continue;
+        }
+
+        if ((header.site >= offsets.size) ||
+            (ListMut::get(offsets, header.site) == ::std::size_t(-1)))
+          return false;
+        char const *format =
+            &ListMut::get(text, ListMut::get(offsets, header.site));
+        if (not write_record(out, format,
+                             *reinterpret_cast<Header const *>(payload)))
+          return false;
+      }
+
+      return feof(in) != 0;
+    }
+
+    template <typename F> struct Flusher {
+      Logger &logger;
+      F &sink;
+      ::std::chrono::microseconds interval;
+      ::std::atomic<bool> stopped;
+      ::std::thread thread;
+
+      Flusher(Flusher const &) = delete;
+      Flusher &
+      operator=(Flusher const &) = delete;
+
+      Flusher(Logger &logger, F &sink,
+              ::std::chrono::microseconds interval =
+                  ::std::chrono::microseconds(1000))
+          : logger(logger)
+          , sink(sink)
+          , interval(interval)
+          , stopped(false)
+          , thread([this] { run(); }) {
+      }
+
+      void
+      run() {
+        while (not stopped.load(::std::memory_order_acquire))
+          if (logger.drain(sink) == 0)
+            ::std::this_thread::sleep_for(interval);
+        logger.drain(sink);
+      }
+
+      ~Flusher() {
+        stopped.store(true, ::std::memory_order_release);
+        thread.join();
+      }
+    };
+  }
+
+  using logger::Site;
+  using logger::Logger;
+  using logger::LogHandle;
+  using logger::TextSink;
+  using logger::FileSink;
+  using logger::Flusher;
+  using logger::decode_file;
+}
+
+#define LOG(handle, str, ...)                                                  \
+  ({                                                                           \
+    struct S {                                                                 \
+      const char s[sizeof(str)] = (str);                                       \
+    };                                                                         \
+    ::ttl::logging::logger::log<S>((handle), ##__VA_ARGS__);                   \
+  })
+
+#ifdef TTL_ENABLE_TEST
+namespace logging {
+  namespace logger {
+    namespace {
+      struct Collect {
+        char lines[8][128];
+        ::std::size_t n;
+        bool ok;
+
+        void
+        operator()(Site const &site, Header const &header) {
+          Writer w{lines[n], lines[n] + sizeof(lines[n]) - 1, 0};
+          ok = ok && (n < 8) &&
+               decode(w, site.format,
+                      reinterpret_cast<char const *>(&header + 1),
+                      header.size - sizeof(Header));
+          *w.cursor = 0;
+          n += 1;
+        }
+      };
+
+      struct Sequence {
+        ::std::size_t counts[2];
+        bool ok;
+
+        void
+        operator()(Site const &, Header const &header) {
+          ::std::uint64_t values[2];
+          __builtin_memcpy(values, &header + 1, sizeof(values));
+          ok = ok && (values[0] < 2) && (values[1] == counts[values[0]]);
+          counts[values[0] < 2 ? values[0] : 0] += 1;
+        }
+      };
+
+      TESTCASE("test deferred logging") {
+        Logger logger(4096);
+
+        SECTION("decode") {
+          Collect collect{{}, 0, true};
+          char expected[128];
+          {
+            LogHandle handle(logger);
+            ASSERT(LOG(handle, "plain text"));
+            ASSERT(LOG(handle, "%`64u %`32d %x %c", ::std::uint64_t(-1),
+                       ::std::int32_t(-5), 0xbeefu, 'z'));
+            ASSERT(LOG(handle, "[%-8s][%.3s][%s]", "ab", "abcdef", "x"));
+            ASSERT(LOG(handle, "%.2f %p %hhd", 2.5, (void *)0x10,
+                       (signed char)(-3)));
+          }
+          ASSERT(logger.drain(collect) == 4);
+          ASSERT(logger.rings == nullptr);
+          ASSERT(collect.ok);
+
+          ASSERT(strcmp(collect.lines[0], "plain text") == 0);
+          FORMAT_TO(expected, sizeof(expected), "%`64u %`32d %x %c",
+                    ::std::uint64_t(-1), ::std::int32_t(-5), 0xbeefu, 'z');
+          ASSERT(strcmp(collect.lines[1], expected) == 0);
+          ASSERT(strcmp(collect.lines[2], "[ab      ][abc][x]") == 0);
+          FORMAT_TO(expected, sizeof(expected), "%.2f %p %hhd", 2.5,
+                    (void *)0x10, (signed char)(-3));
+          ASSERT(strcmp(collect.lines[3], expected) == 0);
+        }
+
+        SECTION("sites") {
+          LogHandle handle(logger);
+          for (::std::size_t i = 0; i < 2; ++i)
+            ASSERT(LOG(handle, "loop %`zu", i));
+
+          Header const *first = handle.ring->peek();
+          ASSERT(first != nullptr);
+          Site const *site = logger.find(first->site);
+          ASSERT(site != nullptr);
+          ASSERT(strcmp(site->format, "loop %`zu") == 0);
+          ASSERT(site == logger.find(first->site));
+          ASSERT(logger.find(0) == nullptr);
+        }
+
+        SECTION("drop") {
+          Logger small(64);
+          LogHandle handle(small);
+          ASSERT(LOG(handle, "%d", 1));
+          ASSERT(LOG(handle, "%d", 2));
+          ASSERT(not LOG(handle, "%d", 3));
+          ASSERT(small.dropped() == 1);
+        }
+
+        SECTION("threads") {
+          Sequence sequence{{0, 0}, true};
+          ::std::thread producers[2];
+          for (::std::size_t p = 0; p < 2; ++p)
+            producers[p] = ::std::thread([&logger, p] {
+              LogHandle handle(logger);
+              for (::std::size_t i = 0; i < 10000;)
+                if (LOG(handle, "%`zu %`zu", p, i))
+                  ++i;
+                else
+                  ::std::this_thread::yield();
+            });
+
+          while ((sequence.counts[0] + sequence.counts[1] < 20000) &&
+                 sequence.ok)
+            if (logger.drain(sequence) == 0)
+              ::std::this_thread::yield();
+          for (::std::thread &producer : producers)
+            producer.join();
+          logger.drain(sequence);
+
+          ASSERT(sequence.ok);
+          ASSERT(sequence.counts[0] == 10000);
+          ASSERT(sequence.counts[1] == 10000);
+          ASSERT(logger.rings == nullptr);
+        }
+
+        SECTION("file") {
+          FILE *binary = tmpfile();
+          FILE *text = tmpfile();
+          {
+            FileSink sink(binary);
+            Flusher<FileSink> flusher(logger, sink);
+            LogHandle handle(logger);
+            for (::std::size_t i = 0; i < 3; ++i)
+              ASSERT(LOG(handle, "value=%`zu name=%s", i, "n"));
+          }
+
+          rewind(binary);
+          ASSERT(decode_file(binary, text));
+          rewind(text);
+
+          char line[128];
+          for (::std::size_t i = 0; i < 3; ++i) {
+            char expected[32];
+            FORMAT_TO(expected, sizeof(expected), " value=%`zu name=n\n", i);
+            ASSERT(fgets(line, sizeof(line), text) != nullptr);
+            ASSERT(strstr(line, expected) != nullptr);
+          }
+          ASSERT(fgets(line, sizeof(line), text) == nullptr);
+
+          rewind(binary);
+          fputc('x', binary);
+          rewind(binary);
+          ASSERT(not decode_file(binary, text));
+
+          fclose(binary);
+          fclose(text);
+        }
+
+        SECTION("long") {
+          FILE *binary = tmpfile();
+          FILE *text = tmpfile();
+          char name[2001];
+          ::std::memset(name, 'a', 2000);
+          name[2000] = 0;
+          {
+            FileSink sink(binary);
+            Flusher<FileSink> flusher(logger, sink);
+            LogHandle handle(logger);
+            ASSERT(LOG(handle, "name=%s.", (char const *)name));
+          }
+
+          rewind(binary);
+          ASSERT(decode_file(binary, text));
+          rewind(text);
+          char line[4096];
+          ASSERT(fgets(line, sizeof(line), text) != nullptr);
+          char const *value = strstr(line, "name=");
+          ASSERT(value != nullptr);
+          ASSERT(strcmp(value + 5 + 2000, ".\n") == 0);
+
+          fclose(binary);
+          fclose(text);
+        }
+
+        SECTION("corrupt") {
+          auto decode_records = [](char const *format,
+                                   ::std::uint64_t const *payload,
+                                   ::std::size_t words,
+                                   ::std::uint64_t id = 1) {
+            FILE *binary = tmpfile();
+            FILE *text = tmpfile();
+            Header definition{sizeof(Header) + 8, DEFINITION, id};
+            Header record{::std::uint32_t(sizeof(Header) + 8 * words), 1, 0};
+            fwrite(MAGIC, 1, sizeof(MAGIC), binary);
+            fwrite(&definition, sizeof(definition), 1, binary);
+            fwrite(format, 1, 8, binary);
+            fwrite(&record, sizeof(record), 1, binary);
+            fwrite(payload, 8, words, binary);
+            rewind(binary);
+            bool decoded = decode_file(binary, text);
+            fclose(binary);
+            fclose(text);
+            return decoded;
+          };
+
+          ::std::uint64_t string[2] = {1, 'x'};
+          ASSERT(decode_records("[%s]\0\0\0", string, 2));
+          string[0] = ::std::uint64_t(-3);
+          ASSERT(not decode_records("[%s]\0\0\0", string, 2));
+          string[0] = 9;
+          ASSERT(not decode_records("[%s]\0\0\0", string, 2));
+          string[0] = 1;
+          ASSERT(not decode_records("[%s]xxxx", string, 2));
+          ASSERT(not decode_records("[%s]\0\0\0", string, 2,
+                                    ::std::uint64_t(1) << 40));
+        }
+      }
+    }
+  }
+}
+#endif
+
+#ifdef TTL_ENABLE_BENCH
+namespace logging {
+  namespace logger {
+    namespace {
+      using ::ttl::test::Bench;
+      using ::ttl::test::Random;
+      using ::ttl::test::do_not_optimize;
+
+      struct Discard {
+        void
+        operator()(Site const &, Header const &header) {
+          do_not_optimize(header.time);
+        }
+      };
+
+      template <typename F>
+      void
+      bench_deferred(Bench &bench, F &sink) {
+        Logger logger(1 << 20);
+        LogHandle handle(logger);
+        Random random;
+
+        for (::std::size_t i : bench) {
+          ::std::uint64_t v = random.next() >> (i & 63);
+          while (not LOG(handle, "id=%`64u size=%`32u name=%s tag=%x", v,
+                         ::std::uint32_t(v), "record", unsigned(v >> 32)))
+            logger.drain(sink);
+        }
+        logger.drain(sink);
+      }
+
+      BENCHMARK("log/deferred/discard") {
+        Discard sink;
+        bench_deferred(bench, sink);
+      }
+
+      BENCHMARK("log/deferred/file") {
+        FILE *file = fopen("/dev/null", "wb");
+        {
+          FileSink sink(file);
+          bench_deferred(bench, sink);
+        }
+        fclose(file);
+      }
+
+      BENCHMARK("log/deferred/text") {
+        FILE *file = fopen("/dev/null", "wb");
+        TextSink sink{file};
+        bench_deferred(bench, sink);
+        fclose(file);
+      }
+
+      BENCHMARK("log/fprintf") {
+        FILE *file = fopen("/dev/null", "wb");
+        Random random;
+        for (::std::size_t i : bench) {
+          ::std::uint64_t v = random.next() >> (i & 63);
+          fprintf(file, FORMAT("id=%`64u size=%`32u name=%s tag=%x\n"), v,
+                  ::std::uint32_t(v), "record", unsigned(v >> 32));
+        }
+        fclose(file);
+      }
+    }
+  }
+}
+#endif
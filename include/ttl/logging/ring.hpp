@@ -0,0 +1,178 @@
+namespace logging {
+  namespace ring {
+    using ::ttl::storage::Chunk;
+
+    static constexpr ::std::uint32_t PADDING = 0;
+    static constexpr ::std::size_t CACHE_LINE = 64;
+
+    struct Header {
+      ::std::uint32_t size;
+      ::std::uint32_t site;
+      ::std::uint64_t time;
+    };
+
+    constexpr ::std::size_t
+    align(::std::size_t n) {
+      return (n + 7) & ~::std::size_t(7);
+    }
+
+    constexpr ::std::size_t
+    round_up(::std::size_t n) {
+      return (n <= 64) ? 64 : ::std::size_t(1) << (64 - __builtin_clzll(n - 1));
+    }
+
+    struct Ring {
+      Chunk<::std::uint64_t> data;
+      ::std::size_t capacity;
+      Ring *next;
+      ::std::atomic<bool> closed;
+      char producer[CACHE_LINE];
+      ::std::atomic<::std::size_t> head;
+      ::std::size_t limit;
+      ::std::size_t pending;
+      ::std::atomic<::std::size_t> dropped;
+      char consumer[CACHE_LINE];
+      ::std::atomic<::std::size_t> tail;
+      char end[CACHE_LINE];
+
+      Ring(Ring const &) = delete;
+      Ring &
+      operator=(Ring const &) = delete;
+
+      Ring(::std::size_t capacity)
+          : data(round_up(capacity) / 8)
+          , capacity(round_up(capacity))
+          , next(nullptr)
+          , closed(false)
+          , head(0)
+          , limit(round_up(capacity))
+          , pending(0)
+          , dropped(0)
+          , tail(0) {
+      }
+
+      char *
+      at(::std::size_t position) {
+        return reinterpret_cast<char *>(data.data) +
+               (position & (capacity - 1));
+      }
+
+      char *
+      reserve(::std::size_t n) {
+        CHECK_FULL(n == align(n));
+        ::std::size_t h = head.load(::std::memory_order_relaxed);
+        ::std::size_t offset = h & (capacity - 1);
+        ::std::size_t skip = (offset + n > capacity) ? capacity - offset : 0;
+
+        if (h + skip + n > limit) {
+          limit = tail.load(::std::memory_order_acquire) + capacity;
+          if (h + skip + n > limit) {
+            dropped.store(dropped.load(::std::memory_order_relaxed) + 1,
+                          ::std::memory_order_relaxed);
+            return nullptr;
+          }
+        }
+
+        if (skip > 0) {
+          ::std::uint32_t *word = reinterpret_cast<::std::uint32_t *>(at(h));
+          word[0] = ::std::uint32_t(skip);
+          word[1] = PADDING;
+        }
+
+        pending = skip + n;
+        return at(h + skip);
+      }
+
+      void
+      commit() {
+        head.store(head.load(::std::memory_order_relaxed) + pending,
+                   ::std::memory_order_release);
+      }
+
+      Header const *
+      peek() {
+        ::std::size_t t = tail.load(::std::memory_order_relaxed);
+        while (t != head.load(::std::memory_order_acquire)) {
+          ::std::uint32_t const *word =
+              reinterpret_cast<::std::uint32_t const *>(at(t));
+          if (word[1] != PADDING)
+            return reinterpret_cast<Header const *>(word);
+          t += word[0];
+          tail.store(t, ::std::memory_order_release);
+        }
+        return nullptr;
+      }
+
+      void
+      release(Header const *header) {
+        tail.store(tail.load(::std::memory_order_relaxed) + header->size,
+                   ::std::memory_order_release);
+      }
+    };
+  }
+
+  using ring::Header;
+  using ring::Ring;
+}
+
+#ifdef TTL_ENABLE_TEST
+namespace logging {
+  namespace ring {
+    namespace {
+      Header *
+      record(Ring &ring, ::std::size_t size, ::std::uint32_t site) {
+        Header *header = reinterpret_cast<Header *>(ring.reserve(size));
+        if (header == nullptr)
+          return nullptr;
+        header->size = ::std::uint32_t(size);
+        header->site = site;
+        header->time = 0;
+        ring.commit();
+        return header;
+      }
+
+      TESTCASE("test log ring") {
+        Ring ring(100);
+        ASSERT(ring.capacity == 128);
+        ASSERT(ring.peek() == nullptr);
+
+        SECTION("fifo") {
+          ASSERT(record(ring, 16, 1) != nullptr);
+          ASSERT(record(ring, 32, 2) != nullptr);
+          ASSERT(ring.peek()->site == 1);
+          ring.release(ring.peek());
+          ASSERT(ring.peek()->site == 2);
+          ring.release(ring.peek());
+          ASSERT(ring.peek() == nullptr);
+        }
+
+        SECTION("full") {
+          for (::std::uint32_t i = 1; i <= 4; ++i)
+            ASSERT(record(ring, 32, i) != nullptr);
+          ASSERT(record(ring, 16, 5) == nullptr);
+          ASSERT(ring.dropped.load() == 1);
+
+          ring.release(ring.peek());
+          ASSERT(record(ring, 16, 5) != nullptr);
+          ASSERT(ring.peek()->site == 2);
+        }
+
+        SECTION("wrap") {
+          ASSERT(record(ring, 48, 1) != nullptr);
+          ASSERT(record(ring, 48, 2) != nullptr);
+          ring.release(ring.peek());
+          ring.release(ring.peek());
+
+          Header *header = record(ring, 48, 3);
+          ASSERT(header == reinterpret_cast<Header *>(ring.at(0)));
+          ASSERT(ring.peek() == header);
+          ASSERT(ring.tail.load() == 128);
+          ring.release(header);
+          ASSERT(ring.peek() == nullptr);
+          ASSERT(ring.head.load() == 176);
+        }
+      }
+    }
+  }
+}
+#endif
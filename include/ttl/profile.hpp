@@ -0,0 +1 @@
+#include <ttl/profile/region.hpp>
@@ -0,0 +1,186 @@
+namespace profile {
+
+  enum class Event {
+    CYCLES,
+    INSTRUCTIONS,
+    L1D_MISSES,
+    LLC_MISSES,
+    BRANCH_MISSES,
+    DTLB_MISSES,
+    PAGE_FAULTS,
+  };
+
+  static constexpr ::std::size_t EVENTS = 7;
+  static constexpr ::std::uint32_t ALL_EVENTS = (1u << EVENTS) - 1;
+
+  static constexpr char const *EVENT_NAMES[EVENTS] = {
+      "cycles",        "instructions", "l1d-misses", "llc-misses",
+      "branch-misses", "dtlb-misses",  "page-faults"};
+
+  struct Sample {
+    ::std::uint32_t available;
+    ::std::uint64_t values[EVENTS];
+  };
+
+  inline bool
+  has(Sample const &sample, Event event) {
+    return (sample.available >> ::std::size_t(event)) & 1;
+  }
+
+  inline ::std::uint64_t
+  get(Sample const &sample, Event event) {
+    return sample.values[::std::size_t(event)];
+  }
+
+  inline Sample
+  difference(Sample const &end, Sample const &begin) {
+    Sample sample = {end.available & begin.available, {}};
+    for (::std::size_t i = 0; i < EVENTS; ++i)
+      if ((sample.available >> i) & 1)
+        sample.values[i] = end.values[i] - begin.values[i];
+    return sample;
+  }
+
+  inline void
+  accumulate(Sample &total, Sample const &sample) {
+    total.available |= sample.available;
+    for (::std::size_t i = 0; i < EVENTS; ++i)
+      total.values[i] += sample.values[i];
+  }
+
+  inline void
+  print(::std::FILE *file, Sample const &sample, double scale = 1) {
+    for (::std::size_t i = 0; i < EVENTS; ++i)
+      if ((sample.available >> i) & 1)
+        ::std::fprintf(file, " %s=%.4g", EVENT_NAMES[i],
+                       double(sample.values[i]) / scale);
+    if (has(sample, Event::CYCLES) && has(sample, Event::INSTRUCTIONS) &&
+        (get(sample, Event::CYCLES) > 0))
+      ::std::fprintf(file, " ipc=%.2f",
+                     double(get(sample, Event::INSTRUCTIONS)) /
+                         double(get(sample, Event::CYCLES)));
+  }
+
+#ifdef __linux__
+  inline ::perf_event_attr
+  attr(Event event) {
+    constexpr ::std::uint64_t READ_MISS = (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                                          (PERF_COUNT_HW_CACHE_RESULT_MISS
+                                           << 16);
+    ::perf_event_attr attr;
+    ::std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED |
+                       PERF_FORMAT_TOTAL_TIME_RUNNING;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+
+    switch (event) {
+    case Event::CYCLES:
+      attr.config = PERF_COUNT_HW_CPU_CYCLES;
+      break;
+    case Event::INSTRUCTIONS:
+      attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+      break;
+    case Event::L1D_MISSES:
+      attr.type = PERF_TYPE_HW_CACHE;
+      attr.config = PERF_COUNT_HW_CACHE_L1D | READ_MISS;
+      break;
+    case Event::LLC_MISSES:
+      attr.type = PERF_TYPE_HW_CACHE;
+      attr.config = PERF_COUNT_HW_CACHE_LL | READ_MISS;
+      break;
+    case Event::BRANCH_MISSES:
+      attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+      break;
+    case Event::DTLB_MISSES:
+      attr.type = PERF_TYPE_HW_CACHE;
+      attr.config = PERF_COUNT_HW_CACHE_DTLB | READ_MISS;
+      break;
+    case Event::PAGE_FAULTS:
+      attr.type = PERF_TYPE_SOFTWARE;
+      attr.config = PERF_COUNT_SW_PAGE_FAULTS;
+      break;
+    }
+    return attr;
+  }
+#endif
+
+  struct Counters {
+    ::pid_t pid;
+    int leader;
+    int fds[EVENTS];
+    ::std::uint32_t available;
+
+    Counters(Counters const &) = delete;
+    Counters &
+    operator=(Counters const &) = delete;
+
+    Counters(::std::uint32_t events = ALL_EVENTS)
+        : pid(::getpid())
+        , leader(-1)
+        , fds()
+        , available(0) {
+      for (::std::size_t i = 0; i < EVENTS; ++i)
+        fds[i] = -1;
+
+#ifdef __linux__
+      for (::std::size_t i = 0; i < EVENTS; ++i) {
+        if (not((events >> i) & 1))
+          continue;
+        ::perf_event_attr a = attr(Event(i));
+        fds[i] = int(::syscall(SYS_perf_event_open, &a, 0, -1, leader,
+                               PERF_FLAG_FD_CLOEXEC));
+        if (fds[i] < 0)
+          continue;
+        if (leader < 0)
+          leader = fds[i];
+        available |= 1u << i;
+      }
+#else
+      (void)events;
+#endif
+    }
+
+    ~Counters() {
+      for (int fd : fds)
+        if (fd >= 0)
+          ::close(fd);
+    }
+
+    Sample
+    read() const {
+      Sample sample = {0, {}};
+      if (leader < 0)
+        return sample;
+
+      ::std::uint64_t buffer[3 + EVENTS];
+      ::ssize_t n = ::read(leader, buffer, sizeof(buffer));
+      if ((n < ::ssize_t(3 * sizeof(::std::uint64_t))) || (buffer[2] == 0))
+        return sample;
+
+      double scale = double(buffer[1]) / double(buffer[2]);
+      ::std::size_t j = 3;
+      for (::std::size_t i = 0; i < EVENTS; ++i) {
+        if (not((available >> i) & 1))
+          continue;
+        if (j - 3 >= buffer[0])
+          break;
+        sample.values[i] = ::std::uint64_t(double(buffer[j++]) * scale);
+        sample.available |= 1u << i;
+      }
+      return sample;
+    }
+  };
+
+  inline Counters &
+  thread_counters() {
+    static thread_local Counters counters;
+    if (counters.pid != ::getpid()) {
+      counters.~Counters();
+      new (&counters) Counters();
+    }
+    return counters;
+  }
+}
@@ -0,0 +1,246 @@
+namespace profile {
+
+  struct Region {
+    Region *next;
+    char const *name;
+    ::std::atomic<::std::uint64_t> calls;
+    ::std::atomic<::std::uint32_t> available;
+    ::std::atomic<::std::uint64_t> values[EVENTS];
+
+    Region(Region const &) = delete;
+    Region &
+    operator=(Region const &) = delete;
+
+    Region(char const *name)
+        : next(NULL)
+        , name(name)
+        , calls(0)
+        , available(0)
+        , values() {
+      ::std::lock_guard<::std::mutex> guard(lock());
+      if (!first())
+        first() = this;
+      if (last())
+        last()->next = this;
+      last() = this;
+    }
+
+    ~Region() {
+      ::std::lock_guard<::std::mutex> guard(lock());
+      Region *prev = NULL;
+      for (Region **p = &first(); *p; prev = *p, p = &(*p)->next) {
+        if (*p != this)
+          continue;
+        *p = next;
+        if (last() == this)
+          last() = prev;
+        break;
+      }
+    }
+
+    static Region *&
+    first() {
+      static Region *region = NULL;
+      return region;
+    }
+
+    static Region *&
+    last() {
+      static Region *region = NULL;
+      return region;
+    }
+
+    static ::std::mutex &
+    lock() {
+      static ::std::mutex mutex;
+      return mutex;
+    }
+  };
+
+  inline void
+  record(Region &region, Sample const &sample) {
+    region.calls.fetch_add(1, ::std::memory_order_relaxed);
+    if (sample.available == 0)
+      return;
+    region.available.fetch_or(sample.available, ::std::memory_order_relaxed);
+    for (::std::size_t i = 0; i < EVENTS; ++i)
+      region.values[i].fetch_add(sample.values[i], ::std::memory_order_relaxed);
+  }
+
+  inline Sample
+  total(Region const &region) {
+    Sample sample = {region.available.load(::std::memory_order_relaxed), {}};
+    for (::std::size_t i = 0; i < EVENTS; ++i)
+      sample.values[i] = region.values[i].load(::std::memory_order_relaxed);
+    return sample;
+  }
+
+  inline void
+  reset(Region &region) {
+    region.calls.store(0, ::std::memory_order_relaxed);
+    region.available.store(0, ::std::memory_order_relaxed);
+    for (::std::size_t i = 0; i < EVENTS; ++i)
+      region.values[i].store(0, ::std::memory_order_relaxed);
+  }
+
+  struct Scope {
+    Region &region;
+    Counters &counters;
+    Sample begin;
+
+    Scope(Scope const &) = delete;
+    Scope &
+    operator=(Scope const &) = delete;
+
+    Scope(Region &region)
+        : region(region)
+        , counters(thread_counters())
+        , begin(counters.read()) {
+    }
+
+    ~Scope() {
+      record(region, difference(counters.read(), begin));
+    }
+  };
+
+  inline void
+  report(::std::FILE *file) {
+    ::std::lock_guard<::std::mutex> guard(Region::lock());
+    for (Region *p = Region::first(); p; p = p->next) {
+      ::std::uint64_t calls = p->calls.load(::std::memory_order_relaxed);
+      if (calls == 0)
+        continue;
+      ::std::fprintf(file, "%-40s %10llu calls", p->name,
+                     (unsigned long long)calls);
+      print(file, total(*p), double(calls));
+      ::std::fprintf(file, "\n");
+    }
+  }
+}
+
+#define _TTLPROFILE_NAME(s, x) __ttlprofile_##s##x
+
+#define _TTLPROFILE_REGION(x, name)                                            \
+  static ::ttl::profile::Region _TTLPROFILE_NAME(region, x)(name);             \
+  ::ttl::profile::Scope _TTLPROFILE_NAME(scope, x)(_TTLPROFILE_NAME(region, x))
+
+#define PROFILE_REGION(name) _TTLPROFILE_REGION(__COUNTER__, (name))
+
+#ifdef TTL_ENABLE_TEST
+namespace profile {
+  namespace region {
+    namespace {
+      using ::ttl::collections::Array;
+      using ::ttl::collections::ForwardList;
+      using ::ttl::collections::flist::Node;
+      using ::ttl::storage::Pool;
+      using ::ttl::traits::Stack;
+
+      TESTCASE("test profile") {
+        SECTION("counters") {
+          Counters counters;
+          Sample begin = counters.read();
+          ::std::size_t size = 64 << 20;
+          char *data = static_cast<char *>(::mmap(
+              nullptr, size, PROT_READ | PROT_WRITE,
+              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+          ASSERT(data != MAP_FAILED);
+          for (::std::size_t i = 0; i < size; i += 4096)
+            data[i] = 1;
+          Sample sample = difference(counters.read(), begin);
+          ::munmap(data, size);
+
+          ASSERT(sample.available == counters.available);
+          if (has(sample, Event::PAGE_FAULTS)) {
+            ASSERT(get(sample, Event::PAGE_FAULTS) > 0);
+          }
+          if (has(sample, Event::INSTRUCTIONS)) {
+            ASSERT(get(sample, Event::INSTRUCTIONS) > size / 4096);
+          }
+        }
+
+        SECTION("unavailable") {
+          Counters counters(0);
+          ASSERT(counters.available == 0);
+          Sample sample = counters.read();
+          ASSERT(sample.available == 0);
+          ASSERT(not has(sample, Event::CYCLES));
+
+          Region region("test/unavailable");
+          { Scope scope(region); }
+          ASSERT(region.calls == 1);
+        }
+
+        SECTION("region") {
+          Region region("test/region");
+          for (::std::size_t i = 0; i < 10; ++i) {
+            Scope scope(region);
+            Array<::std::size_t> array(0);
+            for (::std::size_t j = 0; j < 1000; ++j)
+              Stack::push(array, ::std::move(j));
+          }
+          ASSERT(region.calls == 10);
+          ASSERT(total(region).available == thread_counters().available);
+          reset(region);
+          ASSERT(region.calls == 0);
+        }
+
+        SECTION("unlink") {
+          Region *tail = Region::last();
+          {
+            Region a("test/unlink/a");
+            Region b("test/unlink/b");
+            ASSERT(Region::last() == &b);
+            ASSERT(a.next == &b);
+          }
+          ASSERT(Region::last() == tail);
+          for (Region *p = Region::first(); p; p = p->next)
+            ASSERT(::std::strncmp(p->name, "test/unlink/", 12) != 0);
+        }
+
+        SECTION("macro") {
+          ForwardList<::std::size_t, Pool<Node<::std::size_t>>> list(1000);
+          for (::std::size_t i = 0; i < 1000; ++i)
+            Stack::push(list, ::std::move(i));
+          for (::std::size_t i = 0; i < 3; ++i) {
+            PROFILE_REGION("test/flist/pop");
+            while (not Stack::is_empty(list))
+              Stack::drop(list);
+          }
+
+          Region *region = Region::first();
+          while (::std::strcmp(region->name, "test/flist/pop") != 0)
+            region = region->next;
+          ASSERT(region->calls == 3);
+        }
+      }
+    }
+  }
+}
+#endif
+
+#ifdef TTL_ENABLE_BENCH
+namespace profile {
+  namespace region {
+    namespace {
+      using ::ttl::test::Bench;
+      using ::ttl::test::do_not_optimize;
+
+      BENCHMARK("profile/read") {
+        Counters &counters = thread_counters();
+        for (::std::size_t i : bench) {
+          do_not_optimize(counters.read());
+          do_not_optimize(i);
+        }
+      }
+
+      BENCHMARK("profile/scope") {
+        for (::std::size_t i : bench) {
+          PROFILE_REGION("bench/profile/scope");
+          do_not_optimize(i);
+        }
+      }
+    }
+  }
+}
+#endif
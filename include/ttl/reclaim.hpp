@@ -0,0 +1,2 @@
+#include <ttl/reclaim/epoch.hpp>
+#include <ttl/reclaim/hazard.hpp>
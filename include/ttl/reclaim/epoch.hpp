@@ -0,0 +1,338 @@
+namespace reclaim {
+  namespace epoch {
+    using ::ttl::traits::Allocator;
+    using ::ttl::traits::ListMut;
+    using ::ttl::traits::Stack;
+    using ::ttl::collections::Array;
+
+    template <typename A> struct EpochDomain;
+
+    template <typename A> struct EpochHandle {
+      using Item = typename Allocator::Impl<A>::Item;
+
+      struct Retired {
+        Item *ptr;
+        ::std::uint64_t epoch;
+      };
+
+      EpochDomain<A> &domain;
+      ::std::atomic<::std::uint64_t> state;
+      ::std::size_t depth;
+      Array<Retired> retired;
+      EpochHandle *prev, *next;
+
+      EpochHandle(EpochHandle const &) = delete;
+      EpochHandle &
+      operator=(EpochHandle const &) = delete;
+
+      EpochHandle(EpochDomain<A> &domain)
+          : domain(domain)
+          , state(0)
+          , depth(0)
+          , retired(0)
+          , prev(nullptr)
+          , next(nullptr) {
+        domain.attach(*this);
+      }
+
+      void
+      enter() {
+        if (depth++ == 0)
+          state.exchange(
+              (domain.epoch.load(::std::memory_order_relaxed) << 1) | 1);
+      }
+
+      void
+      exit() {
+        if (--depth == 0)
+          state.store(0, ::std::memory_order_release);
+      }
+
+      void
+      retire(Item *ptr) {
+        ::std::atomic_thread_fence(::std::memory_order_seq_cst);
+        Stack::push(retired,
+                    {ptr, domain.epoch.load(::std::memory_order_relaxed)});
+        if (retired.size >= EpochDomain<A>::BATCH)
+          domain.collect(*this);
+      }
+
+      ~EpochHandle() {
+        domain.detach(*this);
+      }
+    };
+
+    template <typename A> struct EpochDomain {
+      using Handle = EpochHandle<A>;
+      using Item = typename Handle::Item;
+      using Retired = typename Handle::Retired;
+
+      static constexpr ::std::size_t BATCH = 64;
+
+      A &allocator;
+      ::std::atomic<::std::uint64_t> epoch;
+      ::std::mutex mutex;
+      Handle *handles;
+      Array<Retired> orphans;
+
+      EpochDomain(EpochDomain const &) = delete;
+      EpochDomain &
+      operator=(EpochDomain const &) = delete;
+
+      EpochDomain(A &allocator)
+          : allocator(allocator)
+          , epoch(1)
+          , mutex()
+          , handles(nullptr)
+          , orphans(0) {
+      }
+
+      template <typename... Args>
+      Item *
+      construct(Args &&... args) {
+        ::std::lock_guard<::std::mutex> guard(mutex);
+        return Allocator::construct(allocator, ::std::forward<Args>(args)...);
+      }
+
+      void
+      attach(Handle &handle) {
+        ::std::lock_guard<::std::mutex> guard(mutex);
+        handle.next = handles;
+        if (handles != nullptr)
+          handles->prev = &handle;
+        handles = &handle;
+      }
+
+      void
+      detach(Handle &handle) {
+        ::std::lock_guard<::std::mutex> guard(mutex);
+        if (handle.prev != nullptr)
+          handle.prev->next = handle.next;
+        else
+          handles = handle.next;
+        if (handle.next != nullptr)
+          handle.next->prev = handle.prev;
+
+        while (not Stack::is_empty(handle.retired))
+          Stack::push(orphans, Stack::pop(handle.retired));
+
+        try_advance();
+        reclaim(orphans);
+      }
+
+      bool
+      try_advance() {
+        ::std::uint64_t current = epoch.load(::std::memory_order_relaxed);
+        for (Handle *p = handles; p != nullptr; p = p->next) {
+          ::std::uint64_t state = p->state.load(::std::memory_order_acquire);
+          if ((state & 1) && ((state >> 1) != current))
+            return false;
+        }
+
+        epoch.store(current + 1, ::std::memory_order_release);
+        return true;
+      }
+
+      void
+      reclaim(Array<Retired> &list) {
+        ::std::uint64_t current = epoch.load(::std::memory_order_relaxed);
+        ::std::size_t kept = 0;
+
+        for (::std::size_t i = 0; i < list.size; ++i) {
+          Retired &r = ListMut::get(list, i);
+          if (r.epoch + 2 <= current)
+            Allocator::destroy(allocator, r.ptr);
+          else
+            ListMut::get(list, kept++) = r;
+        }
+
+        while (list.size > kept)
+          Stack::drop(list);
+      }
+
+      void
+      collect(Handle &handle) {
+        ::std::lock_guard<::std::mutex> guard(mutex);
+        ::std::atomic_thread_fence(::std::memory_order_seq_cst);
+        try_advance();
+        reclaim(handle.retired);
+        reclaim(orphans);
+      }
+
+      ~EpochDomain() {
+        for (::std::size_t i = 0; i < orphans.size; ++i)
+          Allocator::destroy(allocator, ListMut::get(orphans, i).ptr);
+      }
+    };
+
+    template <typename A> constexpr ::std::size_t EpochDomain<A>::BATCH;
+
+    template <typename A> struct EpochGuard {
+      EpochHandle<A> &handle;
+
+      EpochGuard(EpochGuard const &) = delete;
+      EpochGuard &
+      operator=(EpochGuard const &) = delete;
+
+      EpochGuard(EpochHandle<A> &handle)
+          : handle(handle) {
+        handle.enter();
+      }
+
+      ~EpochGuard() {
+        handle.exit();
+      }
+    };
+  }
+
+  using epoch::EpochDomain;
+  using epoch::EpochHandle;
+  using epoch::EpochGuard;
+}
+
+#ifdef TTL_ENABLE_TEST
+namespace reclaim {
+  namespace epoch {
+    namespace {
+      using ::ttl::test::Counter;
+      using ::ttl::test::Tracked;
+      using ::ttl::storage::SystemAllocator;
+
+      TESTCASE("test epoch reclamation") {
+        using Domain = EpochDomain<SystemAllocator<Counter>>;
+        using Handle = EpochHandle<SystemAllocator<Counter>>;
+        using Guard = EpochGuard<SystemAllocator<Counter>>;
+
+        SystemAllocator<Counter> allocator{};
+        Domain domain(allocator);
+        Counter::count = 0;
+
+        SECTION("guard delays reclamation") {
+          Handle reader(domain);
+          Handle writer(domain);
+
+          {
+            Guard guard(reader);
+            writer.retire(domain.construct());
+            for (::std::size_t i = 0; i < 4; ++i)
+              domain.collect(writer);
+            ASSERT(Counter::count == 0);
+          }
+
+          for (::std::size_t i = 0; i < 4; ++i)
+            domain.collect(writer);
+          ASSERT(Counter::count == 1);
+        }
+
+        SECTION("nested guards") {
+          Handle handle(domain);
+          {
+            Guard outer(handle);
+            { Guard inner(handle); }
+            ASSERT(handle.state.load() != 0);
+          }
+          ASSERT(handle.state.load() == 0);
+        }
+
+        SECTION("batch") {
+          Handle handle(domain);
+          for (::std::size_t i = 0; i < 10 * Domain::BATCH; ++i)
+            handle.retire(domain.construct());
+          ASSERT(Counter::count > 0);
+          ASSERT(Counter::count + handle.retired.size == 10 * Domain::BATCH);
+        }
+
+        SECTION("orphans") {
+          {
+            Handle handle(domain);
+            handle.retire(domain.construct());
+            handle.retire(domain.construct());
+          }
+          ASSERT(domain.orphans.size + Counter::count == 2);
+        }
+      }
+
+      TESTCASE("test epoch reclamation threads") {
+        SystemAllocator<Tracked> allocator{};
+        EpochDomain<SystemAllocator<Tracked>> domain(allocator);
+        ::std::atomic<Tracked *> shared(domain.construct());
+        ::std::atomic<bool> done(false);
+        ::std::atomic<bool> failed(false);
+
+        ::std::thread readers[2];
+        for (::std::thread &reader : readers)
+          reader = ::std::thread([&] {
+            EpochHandle<SystemAllocator<Tracked>> handle(domain);
+            while (not done.load()) {
+              EpochGuard<SystemAllocator<Tracked>> guard(handle);
+              if (not shared.load()->is_alive())
+                failed.store(true);
+            }
+          });
+
+        {
+          EpochHandle<SystemAllocator<Tracked>> handle(domain);
+          for (::std::size_t i = 0; i < 10000; ++i)
+            handle.retire(shared.exchange(domain.construct()));
+          done.store(true);
+        }
+
+        for (::std::thread &reader : readers)
+          reader.join();
+
+        ASSERT(not failed.load());
+        Allocator::destroy(allocator, shared.load());
+      }
+    }
+  }
+}
+#endif
+
+#ifdef TTL_ENABLE_BENCH
+namespace reclaim {
+  namespace epoch {
+    namespace {
+      using ::ttl::test::compare::Small;
+      using ::ttl::test::compare::Large;
+      using ::ttl::test::compare::key;
+      using ::ttl::test::compare::bench_guard;
+      using ::ttl::test::compare::bench_retire;
+      using ::ttl::storage::SystemAllocator;
+
+      template <typename T>
+      ::std::uint64_t
+      read(EpochHandle<SystemAllocator<T>> &handle,
+           ::std::atomic<T *> const &shared) {
+        EpochGuard<SystemAllocator<T>> guard(handle);
+        return key(*shared.load(::std::memory_order_acquire));
+      }
+
+      template <typename T>
+      void
+      bench_epoch_guard(::ttl::test::Bench &bench) {
+        bench_guard<SystemAllocator<T>, EpochDomain<SystemAllocator<T>>,
+                    EpochHandle<SystemAllocator<T>>>(bench, read<T>);
+      }
+
+      template <typename T>
+      void
+      bench_epoch_retire(::ttl::test::Bench &bench) {
+        bench_retire<SystemAllocator<T>, EpochDomain<SystemAllocator<T>>,
+                     EpochHandle<SystemAllocator<T>>>(bench, read<T>);
+      }
+
+      BENCHMARK_RANGE("reclaim/epoch/guard/small", 1000, 10000000) {
+        bench_epoch_guard<Small>(bench);
+      }
+
+      BENCHMARK_RANGE("reclaim/epoch/retire/small", 1000, 1000000) {
+        bench_epoch_retire<Small>(bench);
+      }
+
+      BENCHMARK_RANGE("reclaim/epoch/retire/large", 1000, 1000000) {
+        bench_epoch_retire<Large>(bench);
+      }
+    }
+  }
+}
+#endif
@@ -0,0 +1,358 @@
+namespace reclaim {
+  namespace hazard {
+    using ::ttl::traits::Allocator;
+    using ::ttl::traits::ListMut;
+    using ::ttl::traits::Stack;
+    using ::ttl::collections::Array;
+
+    template <typename A, ::std::size_t K> struct HazardDomain;
+
+    template <typename A, ::std::size_t K = 2> struct HazardHandle {
+      using Item = typename Allocator::Impl<A>::Item;
+      static_assert(K < 32, "hazard slots are tracked in an unsigned mask");
+
+      HazardDomain<A, K> &domain;
+      ::std::atomic<Item *> hazards[K];
+      unsigned used;
+      Array<Item *> retired;
+      HazardHandle *prev, *next;
+
+      HazardHandle(HazardHandle const &) = delete;
+      HazardHandle &
+      operator=(HazardHandle const &) = delete;
+
+      HazardHandle(HazardDomain<A, K> &domain)
+          : domain(domain)
+          , hazards()
+          , used(0)
+          , retired(0)
+          , prev(nullptr)
+          , next(nullptr) {
+        domain.attach(*this);
+      }
+
+      void
+      retire(Item *ptr) {
+        Stack::push(retired, ::std::move(ptr));
+        if (retired.size >= domain.threshold())
+          domain.collect(*this);
+      }
+
+      ~HazardHandle() {
+        domain.detach(*this);
+      }
+    };
+
+    template <typename A, ::std::size_t K = 2> struct HazardDomain {
+      using Handle = HazardHandle<A, K>;
+      using Item = typename Handle::Item;
+
+      static constexpr ::std::size_t BATCH = 64;
+
+      A &allocator;
+      ::std::mutex mutex;
+      Handle *handles;
+      ::std::atomic<::std::size_t> nhandles;
+      Array<Item *> orphans;
+      Array<Item *> protected_;
+
+      HazardDomain(HazardDomain const &) = delete;
+      HazardDomain &
+      operator=(HazardDomain const &) = delete;
+
+      HazardDomain(A &allocator)
+          : allocator(allocator)
+          , mutex()
+          , handles(nullptr)
+          , nhandles(0)
+          , orphans(0)
+          , protected_(0) {
+      }
+
+      ::std::size_t
+      threshold() const {
+        ::std::size_t n = nhandles.load(::std::memory_order_relaxed);
+        return ::std::max(BATCH, 2 * K * n);
+      }
+
+      template <typename... Args>
+      Item *
+      construct(Args &&... args) {
+        ::std::lock_guard<::std::mutex> guard(mutex);
+        return Allocator::construct(allocator, ::std::forward<Args>(args)...);
+      }
+
+      void
+      attach(Handle &handle) {
+        ::std::lock_guard<::std::mutex> guard(mutex);
+        handle.next = handles;
+        if (handles != nullptr)
+          handles->prev = &handle;
+        handles = &handle;
+        nhandles.fetch_add(1, ::std::memory_order_relaxed);
+      }
+
+      void
+      detach(Handle &handle) {
+        ::std::lock_guard<::std::mutex> guard(mutex);
+        if (handle.prev != nullptr)
+          handle.prev->next = handle.next;
+        else
+          handles = handle.next;
+        if (handle.next != nullptr)
+          handle.next->prev = handle.prev;
+        nhandles.fetch_sub(1, ::std::memory_order_relaxed);
+
+        while (not Stack::is_empty(handle.retired))
+          Stack::push(orphans, Stack::pop(handle.retired));
+
+        scan();
+        reclaim(orphans);
+      }
+
+      void
+      scan() {
+        Stack::clear(protected_);
+        for (Handle *p = handles; p != nullptr; p = p->next)
+          for (::std::size_t i = 0; i < K; ++i) {
+            Item *ptr = p->hazards[i].load(::std::memory_order_acquire);
+            if (ptr != nullptr)
+              Stack::push(protected_, ::std::move(ptr));
+          }
+
+        if (protected_.size > 0) {
+          Item **first = &ListMut::get(protected_, 0);
+          ::std::sort(first, first + protected_.size);
+        }
+      }
+
+      bool
+      is_protected(Item *ptr) {
+        if (protected_.size == 0)
+          return false;
+        Item **first = &ListMut::get(protected_, 0);
+        return ::std::binary_search(first, first + protected_.size, ptr);
+      }
+
+      void
+      reclaim(Array<Item *> &list) {
+        ::std::size_t kept = 0;
+
+        for (::std::size_t i = 0; i < list.size; ++i) {
+          Item *ptr = ListMut::get(list, i);
+          if (is_protected(ptr))
+            ListMut::get(list, kept++) = ptr;
+          else
+            Allocator::destroy(allocator, ptr);
+        }
+
+        while (list.size > kept)
+          Stack::drop(list);
+      }
+
+      void
+      collect(Handle &handle) {
+        ::std::lock_guard<::std::mutex> guard(mutex);
+        ::std::atomic_thread_fence(::std::memory_order_seq_cst);
+        scan();
+        reclaim(handle.retired);
+        reclaim(orphans);
+      }
+
+      ~HazardDomain() {
+        for (::std::size_t i = 0; i < orphans.size; ++i)
+          Allocator::destroy(allocator, ListMut::get(orphans, i));
+      }
+    };
+
+    template <typename A, ::std::size_t K>
+    constexpr ::std::size_t HazardDomain<A, K>::BATCH;
+
+    template <typename A, ::std::size_t K = 2> struct HazardGuard {
+      using Item = typename HazardHandle<A, K>::Item;
+
+      HazardHandle<A, K> &handle;
+      ::std::size_t slot;
+
+      HazardGuard(HazardGuard const &) = delete;
+      HazardGuard &
+      operator=(HazardGuard const &) = delete;
+
+      HazardGuard(HazardHandle<A, K> &handle)
+          : handle(handle)
+          , slot(__builtin_ctz(~handle.used)) {
+        CHECK(slot < K);
+        handle.used |= 1u << slot;
+      }
+
+      Item *
+      protect(::std::atomic<Item *> const &source) {
+        Item *ptr = source.load(::std::memory_order_relaxed);
+        while (true) {
+          handle.hazards[slot].exchange(ptr);
+          Item *again = source.load(::std::memory_order_acquire);
+          if (again == ptr)
+            return ptr;
+          ptr = again;
+        }
+      }
+
+      void
+      reset() {
+        handle.hazards[slot].store(nullptr, ::std::memory_order_release);
+      }
+
+      ~HazardGuard() {
+        reset();
+        handle.used &= ~(1u << slot);
+      }
+    };
+  }
+
+  using hazard::HazardDomain;
+  using hazard::HazardHandle;
+  using hazard::HazardGuard;
+}
+
+#ifdef TTL_ENABLE_TEST
+namespace reclaim {
+  namespace hazard {
+    namespace {
+      using ::ttl::test::AssertionFailure;
+      using ::ttl::test::Counter;
+      using ::ttl::test::Tracked;
+      using ::ttl::storage::SystemAllocator;
+
+      TESTCASE("test hazard pointer reclamation") {
+        using Domain = HazardDomain<SystemAllocator<Counter>>;
+        using Handle = HazardHandle<SystemAllocator<Counter>>;
+        using Guard = HazardGuard<SystemAllocator<Counter>>;
+
+        SystemAllocator<Counter> allocator{};
+        Domain domain(allocator);
+        Counter::count = 0;
+
+        SECTION("guard delays reclamation") {
+          Handle reader(domain);
+          Handle writer(domain);
+          ::std::atomic<Counter *> shared(domain.construct());
+
+          {
+            Guard guard(reader);
+            Counter *ptr = guard.protect(shared);
+            shared.store(nullptr);
+            writer.retire(ptr);
+            domain.collect(writer);
+            ASSERT(Counter::count == 0);
+            ASSERT(writer.retired.size == 1);
+          }
+
+          domain.collect(writer);
+          ASSERT(Counter::count == 1);
+          ASSERT(writer.retired.size == 0);
+        }
+
+        SECTION("slots") {
+          Handle handle(domain);
+          {
+            Guard first(handle);
+            Guard second(handle);
+            ASSERT(first.slot != second.slot);
+            ASSERT_THROW(AssertionFailure, Guard third(handle));
+          }
+          ASSERT(handle.used == 0);
+        }
+
+        SECTION("batch") {
+          Handle handle(domain);
+          for (::std::size_t i = 0; i < 10 * Domain::BATCH; ++i)
+            handle.retire(domain.construct());
+          ASSERT(Counter::count + handle.retired.size == 10 * Domain::BATCH);
+          ASSERT(handle.retired.size < Domain::BATCH);
+        }
+      }
+
+      TESTCASE("test hazard pointer reclamation threads") {
+        SystemAllocator<Tracked> allocator{};
+        HazardDomain<SystemAllocator<Tracked>> domain(allocator);
+        ::std::atomic<Tracked *> shared(domain.construct());
+        ::std::atomic<bool> done(false);
+        ::std::atomic<bool> failed(false);
+
+        ::std::thread readers[2];
+        for (::std::thread &reader : readers)
+          reader = ::std::thread([&] {
+            HazardHandle<SystemAllocator<Tracked>> handle(domain);
+            while (not done.load()) {
+              HazardGuard<SystemAllocator<Tracked>> guard(handle);
+              if (not guard.protect(shared)->is_alive())
+                failed.store(true);
+            }
+          });
+
+        {
+          HazardHandle<SystemAllocator<Tracked>> handle(domain);
+          for (::std::size_t i = 0; i < 10000; ++i)
+            handle.retire(shared.exchange(domain.construct()));
+          done.store(true);
+        }
+
+        for (::std::thread &reader : readers)
+          reader.join();
+
+        ASSERT(not failed.load());
+        Allocator::destroy(allocator, shared.load());
+      }
+    }
+  }
+}
+#endif
+
+#ifdef TTL_ENABLE_BENCH
+namespace reclaim {
+  namespace hazard {
+    namespace {
+      using ::ttl::test::compare::Small;
+      using ::ttl::test::compare::Large;
+      using ::ttl::test::compare::key;
+      using ::ttl::test::compare::bench_guard;
+      using ::ttl::test::compare::bench_retire;
+      using ::ttl::storage::SystemAllocator;
+
+      template <typename T>
+      ::std::uint64_t
+      read(HazardHandle<SystemAllocator<T>> &handle,
+           ::std::atomic<T *> const &shared) {
+        HazardGuard<SystemAllocator<T>> guard(handle);
+        return key(*guard.protect(shared));
+      }
+
+      template <typename T>
+      void
+      bench_hazard_guard(::ttl::test::Bench &bench) {
+        bench_guard<SystemAllocator<T>, HazardDomain<SystemAllocator<T>>,
+                    HazardHandle<SystemAllocator<T>>>(bench, read<T>);
+      }
+
+      template <typename T>
+      void
+      bench_hazard_retire(::ttl::test::Bench &bench) {
+        bench_retire<SystemAllocator<T>, HazardDomain<SystemAllocator<T>>,
+                     HazardHandle<SystemAllocator<T>>>(bench, read<T>);
+      }
+
+      BENCHMARK_RANGE("reclaim/hazard/guard/small", 1000, 10000000) {
+        bench_hazard_guard<Small>(bench);
+      }
+
+      BENCHMARK_RANGE("reclaim/hazard/retire/small", 1000, 1000000) {
+        bench_hazard_retire<Small>(bench);
+      }
+
+      BENCHMARK_RANGE("reclaim/hazard/retire/large", 1000, 1000000) {
+        bench_hazard_retire<Large>(bench);
+      }
+    }
+  }
+}
+#endif
@@ -0,0 +1,3 @@
+#include <ttl/serialize/stream.hpp>
+#include <ttl/serialize/array.hpp>
+#include <ttl/serialize/flist.hpp>
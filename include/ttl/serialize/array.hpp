@@ -0,0 +1,343 @@
+namespace traits {
+
+  template <typename T, typename P, typename I>
+  struct Serialize::Impl<
+      ::ttl::collections::Array<T, P, I>,
+      typename ::std::enable_if<::std::is_trivially_copyable<T>::value>::type> {
+  private:
+    using Array = ::ttl::collections::Array<T, P, I>;
+    using Header = ::ttl::serialize::Header;
+
+    static bool
+    reserve(Array &self, ::std::size_t capacity, ::std::true_type) {
+      if (capacity <= Bounded::capacity(self))
+        return true;
+      errno = ENOSPC;
+      return false;
+    }
+
+    static bool
+    reserve(Array &self, ::std::size_t capacity, ::std::false_type) {
+      try {
+        Unbounded::reserve(self, capacity);
+      } catch (::std::bad_alloc const &) {
+        errno = ENOMEM;
+        return false;
+      }
+      return true;
+    }
+
+  public:
+    static bool
+    write(int fd, Array const &self) {
+      Header h = ::ttl::serialize::stream::header<T>(self.size);
+      ::iovec iov[2] = {{&h, sizeof(h)},
+                        {self.data.data, sizeof(T) * self.size}};
+      return ::ttl::serialize::stream::write_all(fd, iov, 2);
+    }
+
+    static bool
+    read(int fd, Array &self) {
+      Header h;
+      if (not ::ttl::serialize::stream::read_header<T>(fd, h))
+        return false;
+      if (not ::ttl::serialize::stream::check_count<T>(h, self.size))
+        return false;
+      if (not reserve(self, self.size + h.count,
+                      ::std::is_same<P, ::ttl::collections::FixedCapacity>()))
+        return false;
+      if (not ::ttl::serialize::stream::read_all(
+              fd, self.data.data + self.size, sizeof(T) * h.count))
+        return false;
+      self.size += h.count;
+      return true;
+    }
+  };
+
+  template <typename T, typename P>
+  struct Serialize::Impl<::ttl::collections::MappedArray<T, P>, void> {
+  private:
+    using MappedArray = ::ttl::collections::MappedArray<T, P>;
+    using Header = ::ttl::serialize::Header;
+
+  public:
+    static bool
+    write(int fd, MappedArray const &self) {
+      ::std::size_t size = Collection::size(self);
+      Header h = ::ttl::serialize::stream::header<T>(size);
+      ::iovec iov[2] = {{&h, sizeof(h)}, {self.data.data, sizeof(T) * size}};
+      return ::ttl::serialize::stream::write_all(fd, iov, 2);
+    }
+
+    static bool
+    read(int fd, MappedArray &self) {
+      CHECK(self.data.is_open());
+
+      Header h;
+      if (not ::ttl::serialize::stream::read_header<T>(fd, h))
+        return false;
+      ::std::size_t size = Collection::size(self);
+      if (not ::ttl::serialize::stream::check_count<T>(h, size))
+        return false;
+      if ((size + h.count > self.data.capacity) &&
+          not self.data.resize(size + h.count))
+        return false;
+      if (not ::ttl::serialize::stream::read_all(fd, self.data.data + size,
+                                                 sizeof(T) * h.count))
+        return false;
+      self.data.header->size = size + h.count;
+      return true;
+    }
+  };
+}
+
+#ifdef TTL_ENABLE_TEST
+namespace serialize {
+  namespace array {
+    namespace {
+      using ::ttl::collections::Array;
+      using ::ttl::collections::FixedCapacity;
+      using ::ttl::collections::MappedArray;
+      using ::ttl::test::TempFile;
+      using ::ttl::traits::Collection;
+      using ::ttl::traits::List;
+      using ::ttl::traits::Serialize;
+      using ::ttl::traits::Stack;
+      using ::ttl::traits::Unbounded;
+
+      TESTCASE("test serialize array") {
+        TempFile file;
+        int fd = ::open(file.path, O_RDWR);
+        ASSERT(fd >= 0);
+
+        Array<::std::uint64_t> a(0);
+        for (::std::uint64_t i = 0; i < 1000; ++i)
+          Stack::push(a, ::std::move(i));
+        ASSERT(Serialize::write(fd, a));
+        ASSERT(::lseek(fd, 0, SEEK_SET) == 0);
+
+        SECTION("append") {
+          Array<::std::uint64_t> b(0);
+          Stack::push(b, 7);
+          ASSERT(Serialize::read(fd, b));
+          ASSERT(b.size == 1001);
+          ASSERT(List::get(b, 0) == 7);
+          ASSERT(List::get(b, 1000) == 999);
+        }
+
+        SECTION("fixed") {
+          Array<::std::uint64_t, FixedCapacity> c(999);
+          errno = 0;
+          ASSERT(not Serialize::read(fd, c));
+          ASSERT(errno == ENOSPC);
+
+          ASSERT(::lseek(fd, 0, SEEK_SET) == 0);
+          Array<::std::uint64_t, FixedCapacity> d(1000);
+          ASSERT(Serialize::read(fd, d));
+          ASSERT(List::get(d, 999) == 999);
+        }
+
+        SECTION("overflow") {
+          Header h = stream::header<::std::uint64_t>(
+              ::std::uint64_t(-1) / 4);
+          ASSERT(::lseek(fd, 0, SEEK_SET) == 0);
+          ASSERT(stream::write_all(fd, &h, sizeof(h)));
+          ASSERT(::lseek(fd, 0, SEEK_SET) == 0);
+
+          Array<::std::uint64_t> g(0);
+          Stack::push(g, 7);
+          errno = 0;
+          ASSERT(not Serialize::read(fd, g));
+          ASSERT(errno == EOVERFLOW);
+          ASSERT(g.size == 1);
+        }
+
+        SECTION("unallocatable") {
+          Header h = stream::header<::std::uint64_t>(::std::uint64_t(1) << 50);
+          ASSERT(::lseek(fd, 0, SEEK_SET) == 0);
+          ASSERT(stream::write_all(fd, &h, sizeof(h)));
+
+          Array<::std::uint64_t> g(0);
+          Stack::push(g, 7);
+          ::std::size_t capacity = Unbounded::capacity(g);
+          ASSERT(::lseek(fd, 0, SEEK_SET) == 0);
+          errno = 0;
+          ASSERT(not Serialize::read(fd, g));
+          ASSERT(errno == ENOMEM);
+          ASSERT(g.size == 1);
+          ASSERT(Unbounded::capacity(g) == capacity);
+          ASSERT(List::get(g, 0) == 7);
+
+          TempFile mapped;
+          MappedArray<::std::uint64_t> m;
+          ASSERT(::ttl::collections::marray::open(m, mapped.path, 0));
+          Stack::push(m, 7);
+          ASSERT(::lseek(fd, 0, SEEK_SET) == 0);
+          errno = 0;
+          ASSERT(not Serialize::read(fd, m));
+          ASSERT(errno != 0);
+          ASSERT(Collection::size(m) == 1);
+          ASSERT(List::get(m, 0) == 7);
+          ASSERT(Unbounded::capacity(m) == 10);
+        }
+
+        SECTION("truncated") {
+          ASSERT(::ftruncate(fd, off_t(sizeof(Header) + 900 * 8)) == 0);
+          Array<::std::uint64_t> g(0);
+          Stack::push(g, 7);
+          errno = 0;
+          ASSERT(not Serialize::read(fd, g));
+          ASSERT(errno == EPROTO);
+          ASSERT(g.size == 1);
+          ASSERT(List::get(g, 0) == 7);
+        }
+
+        SECTION("mismatch") {
+          Array<double> e(0);
+          errno = 0;
+          ASSERT(not Serialize::read(fd, e));
+          ASSERT(errno == EINVAL);
+        }
+
+        SECTION("mapped") {
+          TempFile mapped;
+          MappedArray<::std::uint64_t> m;
+          ASSERT(::ttl::collections::marray::open(m, mapped.path, 0));
+          ASSERT(Serialize::read(fd, m));
+          ASSERT(::lseek(fd, 0, SEEK_SET) == 0);
+          ASSERT(Serialize::read(fd, m));
+          ASSERT(Collection::size(m) == 2000);
+          ASSERT(List::get(m, 1999) == 999);
+
+          ASSERT(::lseek(fd, 0, SEEK_SET) == 0);
+          ASSERT(Serialize::write(fd, m));
+          ASSERT(::lseek(fd, 0, SEEK_SET) == 0);
+          Array<::std::uint64_t> f(0);
+          ASSERT(Serialize::read(fd, f));
+          ASSERT(f.size == 2000);
+          ASSERT(List::get(f, 1000) == 0);
+        }
+
+        ::close(fd);
+      }
+    }
+  }
+}
+#endif
+
+#ifdef TTL_ENABLE_BENCH
+namespace serialize {
+  namespace array {
+    namespace {
+      using ::ttl::collections::Array;
+      using ::ttl::serialize::stream::throughput;
+      using ::ttl::test::Bench;
+      using ::ttl::test::TempFile;
+      using ::ttl::test::do_not_optimize;
+      using ::ttl::traits::List;
+      using ::ttl::traits::Serialize;
+      using ::ttl::traits::Stack;
+
+      Array<::std::uint64_t>
+      make(::std::size_t n) {
+        Array<::std::uint64_t> a(n);
+        for (::std::uint64_t i = 0; i < n; ++i)
+          Stack::push(a, ::std::move(i));
+        return a;
+      }
+
+      BENCHMARK_RANGE("serialize/array/write", 1000, 1000000) {
+        TempFile file;
+        int fd = ::open(file.path, O_RDWR);
+        Array<::std::uint64_t> a = make(bench.arg);
+
+        for (::std::size_t i : bench) {
+          ::lseek(fd, 0, SEEK_SET);
+          do_not_optimize(Serialize::write(fd, a));
+          do_not_optimize(i);
+        }
+        throughput(bench, sizeof(::std::uint64_t) * bench.arg);
+        ::close(fd);
+      }
+
+      BENCHMARK_RANGE("serialize/array/read", 1000, 1000000) {
+        TempFile file;
+        int fd = ::open(file.path, O_RDWR);
+        Serialize::write(fd, make(bench.arg));
+
+        for (::std::size_t i : bench) {
+          ::lseek(fd, 0, SEEK_SET);
+          Array<::std::uint64_t> a(0);
+          Serialize::read(fd, a);
+          do_not_optimize(List::get(a, bench.arg - 1));
+          do_not_optimize(i);
+        }
+        throughput(bench, sizeof(::std::uint64_t) * bench.arg);
+        ::close(fd);
+      }
+
+      BENCHMARK_RANGE("serialize/array/pipe", 1000, 1000000) {
+        int fds[2];
+        if (::pipe(fds) != 0)
+          return;
+        Array<::std::uint64_t> a = make(bench.arg);
+        ::std::size_t iterations = bench.iterations;
+        ::std::thread reader([&fds, iterations]() {
+          for (::std::size_t i = 0; i < iterations; ++i) {
+            Array<::std::uint64_t> b(0);
+            if (not Serialize::read(fds[0], b))
+              break;
+          }
+        });
+
+        for (::std::size_t i : bench) {
+          do_not_optimize(Serialize::write(fds[1], a));
+          do_not_optimize(i);
+        }
+        reader.join();
+        throughput(bench, sizeof(::std::uint64_t) * bench.arg);
+        ::close(fds[0]);
+        ::close(fds[1]);
+      }
+
+      BENCHMARK_RANGE("serialize/array/fwrite_each", 1000, 1000000) {
+        TempFile file;
+        ::std::FILE *f = ::std::fopen(file.path, "w+b");
+        Array<::std::uint64_t> a = make(bench.arg);
+
+        for (::std::size_t i : bench) {
+          ::std::rewind(f);
+          for (::std::size_t j = 0; j < a.size; ++j)
+            ::std::fwrite(&List::get(a, j), sizeof(::std::uint64_t), 1, f);
+          ::std::fflush(f);
+          do_not_optimize(i);
+        }
+        throughput(bench, sizeof(::std::uint64_t) * bench.arg);
+        ::std::fclose(f);
+      }
+
+      BENCHMARK_RANGE("serialize/array/fread_each", 1000, 1000000) {
+        TempFile file;
+        ::std::FILE *f = ::std::fopen(file.path, "w+b");
+        Array<::std::uint64_t> a = make(bench.arg);
+        ::std::fwrite(a.data.data, sizeof(::std::uint64_t), a.size, f);
+
+        for (::std::size_t i : bench) {
+          ::std::rewind(f);
+          Array<::std::uint64_t> b(0);
+          ::std::uint64_t item;
+          for (::std::size_t j = 0; j < bench.arg; ++j) {
+            if (::std::fread(&item, sizeof(item), 1, f) != 1)
+              break;
+            Stack::push(b, ::std::move(item));
+          }
+          do_not_optimize(List::get(b, bench.arg - 1));
+          do_not_optimize(i);
+        }
+        throughput(bench, sizeof(::std::uint64_t) * bench.arg);
+        ::std::fclose(f);
+      }
+    }
+  }
+}
+#endif
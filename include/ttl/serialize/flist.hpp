@@ -0,0 +1,231 @@
+namespace traits {
+
+  template <typename T, typename A>
+  struct Serialize::Impl<
+      ::ttl::collections::ForwardList<T, A>,
+      typename ::std::enable_if<::std::is_trivially_copyable<T>::value>::type> {
+  private:
+    using ForwardList = ::ttl::collections::ForwardList<T, A>;
+    using Header = ::ttl::serialize::Header;
+    using Node = ::ttl::collections::flist::Node<T>;
+
+  public:
+    static bool
+    write(int fd, ForwardList const &self) {
+      constexpr ::std::size_t ITEMS =
+          ::ttl::serialize::stream::frame_items<T>();
+      ::ttl::storage::Chunk<T> frame(ITEMS);
+      Header h = ::ttl::serialize::stream::header<T>(self.size);
+      ::iovec iov[2] = {{&h, sizeof(h)}, {frame.data, 0}};
+      ::iovec *first = iov;
+      ::std::size_t n = 0;
+
+      for (Node const *node = self.top; node != nullptr; node = node->next) {
+        frame.emplace(n++, node->data);
+        if (n < ITEMS)
+          continue;
+
+        iov[1] = {frame.data, sizeof(T) * n};
+        if (not ::ttl::serialize::stream::write_all(fd, first,
+                                                    int(iov + 2 - first)))
+          return false;
+        first = iov + 1;
+        n = 0;
+      }
+
+      iov[1] = {frame.data, sizeof(T) * n};
+      return ::ttl::serialize::stream::write_all(fd, first,
+                                                 int(iov + 2 - first));
+    }
+
+    static bool
+    read(int fd, ForwardList &self) {
+      Header h;
+      if (not ::ttl::serialize::stream::read_header<T>(fd, h))
+        return false;
+      if (not ::ttl::serialize::stream::check_count<T>(h, self.size))
+        return false;
+
+      constexpr ::std::size_t ITEMS =
+          ::ttl::serialize::stream::frame_items<T>();
+      ::ttl::storage::Chunk<T> frame(ITEMS);
+      ::std::size_t k = 0;
+
+      while (k < h.count) {
+        ::std::size_t n = ::std::min(::std::size_t(h.count) - k, ITEMS);
+        if (not ::ttl::serialize::stream::read_all(fd, frame.data,
+                                                   sizeof(T) * n)) {
+          int error = errno;
+          for (; k > 0; --k)
+            ::ttl::traits::Stack::drop(self);
+          errno = error;
+          return false;
+        }
+        ::ttl::collections::flist::push_n(self, frame.data, n);
+        k += n;
+      }
+
+      ::ttl::collections::flist::reverse_front(self, k);
+      return true;
+    }
+  };
+}
+
+#ifdef TTL_ENABLE_TEST
+namespace serialize {
+  namespace flist {
+    namespace {
+      using ::ttl::collections::ForwardList;
+      using ::ttl::test::TempFile;
+      using ::ttl::traits::Serialize;
+      using ::ttl::traits::Stack;
+
+      struct Large {
+        char bytes[stream::FRAME + 8];
+      };
+
+      TESTCASE("test serialize flist") {
+        TempFile file;
+        int fd = ::open(file.path, O_RDWR);
+        ASSERT(fd >= 0);
+
+        SECTION("order") {
+          ForwardList<::std::uint32_t> a;
+          for (::std::uint32_t i = 0; i < 40000; ++i)
+            Stack::push(a, ::std::move(i));
+          ASSERT(Serialize::write(fd, a));
+          ASSERT(::lseek(fd, 0, SEEK_SET) == 0);
+
+          ForwardList<::std::uint32_t> b;
+          Stack::push(b, 7);
+          ASSERT(Serialize::read(fd, b));
+          ASSERT(b.size == 40001);
+          for (::std::uint32_t i = 40000; i > 0; --i)
+            ASSERT(Stack::pop(b) == i - 1);
+          ASSERT(Stack::pop(b) == 7);
+          ASSERT(b.tail == nullptr);
+        }
+
+        SECTION("large") {
+          ForwardList<Large> a;
+          for (char i = 0; i < 3; ++i) {
+            Stack::emplace(a);
+            a.top->data.bytes[stream::FRAME] = i;
+          }
+          ASSERT(Serialize::write(fd, a));
+          ASSERT(::lseek(fd, 0, SEEK_SET) == 0);
+
+          ForwardList<Large> b;
+          ASSERT(Serialize::read(fd, b));
+          ASSERT(b.size == 3);
+          ASSERT(b.top->data.bytes[stream::FRAME] == 2);
+          ASSERT(b.tail->data.bytes[stream::FRAME] == 0);
+        }
+
+        SECTION("truncated") {
+          ForwardList<::std::uint64_t> a;
+          for (::std::uint64_t i = 0; i < 10000; ++i)
+            Stack::push(a, ::std::move(i));
+          ASSERT(Serialize::write(fd, a));
+          ASSERT(::ftruncate(fd, off_t(sizeof(Header) + 9000 * 8)) == 0);
+          ASSERT(::lseek(fd, 0, SEEK_SET) == 0);
+
+          ForwardList<::std::uint64_t> b;
+          Stack::push(b, 7);
+          errno = 0;
+          ASSERT(not Serialize::read(fd, b));
+          ASSERT(errno == EPROTO);
+          ASSERT(b.size == 1);
+          ASSERT(Stack::pop(b) == 7);
+        }
+
+        SECTION("overflow") {
+          Header h = stream::header<::std::uint64_t>(
+              ::std::uint64_t(-1) / 4);
+          ASSERT(stream::write_all(fd, &h, sizeof(h)));
+          ASSERT(::lseek(fd, 0, SEEK_SET) == 0);
+
+          ForwardList<::std::uint64_t> b;
+          errno = 0;
+          ASSERT(not Serialize::read(fd, b));
+          ASSERT(errno == EOVERFLOW);
+          ASSERT(b.size == 0);
+        }
+
+        ::close(fd);
+      }
+    }
+  }
+}
+#endif
+
+#ifdef TTL_ENABLE_BENCH
+namespace serialize {
+  namespace flist {
+    namespace {
+      using ::ttl::collections::ForwardList;
+      using ::ttl::serialize::stream::throughput;
+      using ::ttl::test::Bench;
+      using ::ttl::test::TempFile;
+      using ::ttl::test::do_not_optimize;
+      using ::ttl::traits::Serialize;
+      using ::ttl::traits::Stack;
+
+      BENCHMARK_RANGE("serialize/flist/write", 1000, 1000000) {
+        TempFile file;
+        int fd = ::open(file.path, O_RDWR);
+        ForwardList<::std::uint64_t> l;
+        for (::std::uint64_t j = 0; j < bench.arg; ++j)
+          Stack::push(l, ::std::move(j));
+
+        for (::std::size_t i : bench) {
+          ::lseek(fd, 0, SEEK_SET);
+          do_not_optimize(Serialize::write(fd, l));
+          do_not_optimize(i);
+        }
+        throughput(bench, sizeof(::std::uint64_t) * bench.arg);
+        ::close(fd);
+      }
+
+      BENCHMARK_RANGE("serialize/flist/read", 1000, 1000000) {
+        TempFile file;
+        int fd = ::open(file.path, O_RDWR);
+        {
+          ForwardList<::std::uint64_t> l;
+          for (::std::uint64_t j = 0; j < bench.arg; ++j)
+            Stack::push(l, ::std::move(j));
+          Serialize::write(fd, l);
+        }
+
+        for (::std::size_t i : bench) {
+          ::lseek(fd, 0, SEEK_SET);
+          ForwardList<::std::uint64_t> l;
+          Serialize::read(fd, l);
+          do_not_optimize(l.top);
+          do_not_optimize(i);
+        }
+        throughput(bench, sizeof(::std::uint64_t) * bench.arg);
+        ::close(fd);
+      }
+
+      BENCHMARK_RANGE("serialize/flist/fwrite_each", 1000, 1000000) {
+        TempFile file;
+        ::std::FILE *f = ::std::fopen(file.path, "w+b");
+        ForwardList<::std::uint64_t> l;
+        for (::std::uint64_t j = 0; j < bench.arg; ++j)
+          Stack::push(l, ::std::move(j));
+
+        for (::std::size_t i : bench) {
+          ::std::rewind(f);
+          for (auto *node = l.top; node != nullptr; node = node->next)
+            ::std::fwrite(&node->data, sizeof(::std::uint64_t), 1, f);
+          ::std::fflush(f);
+          do_not_optimize(i);
+        }
+        throughput(bench, sizeof(::std::uint64_t) * bench.arg);
+        ::std::fclose(f);
+      }
+    }
+  }
+}
+#endif
@@ -0,0 +1,171 @@
+namespace serialize {
+  namespace stream {
+    using ::ttl::traits::fingerprint;
+
+    static constexpr ::std::uint32_t MAGIC = 0x736c7474;
+    static constexpr ::std::size_t FRAME = 65536;
+
+    struct Header {
+      ::std::uint32_t magic;
+      ::std::uint32_t item_size;
+      ::std::uint64_t fingerprint;
+      ::std::uint64_t count;
+    };
+
+    template <typename T>
+    Header
+    header(::std::size_t count) {
+      return {MAGIC, sizeof(T), fingerprint<T>(), count};
+    }
+
+    template <typename T>
+    constexpr ::std::size_t
+    frame_items() {
+      return (sizeof(T) < FRAME) ? FRAME / sizeof(T) : 1;
+    }
+
+    inline bool
+    write_all(int fd, ::iovec *iov, int n) {
+      while (n > 0) {
+        ::ssize_t written = ::writev(fd, iov, n);
+        if (written < 0) {
+          if (errno == EINTR)
+            continue;
+          return false;
+        }
+
+        ::std::size_t done = ::std::size_t(written);
+        while ((n > 0) && (done >= iov->iov_len)) {
+          done -= iov->iov_len;
+          ++iov;
+          --n;
+        }
+        if (n > 0) {
+          iov->iov_base = static_cast<char *>(iov->iov_base) + done;
+          iov->iov_len -= done;
+        }
+      }
+      return true;
+    }
+
+    inline bool
+    write_all(int fd, void const *data, ::std::size_t size) {
+      ::iovec iov = {const_cast<void *>(data), size};
+      return write_all(fd, &iov, 1);
+    }
+
+    inline bool
+    read_all(int fd, void *data, ::std::size_t size) {
+      char *p = static_cast<char *>(data);
+      while (size > 0) {
+        ::ssize_t n = ::read(fd, p, size);
+        if (n < 0) {
+          if (errno == EINTR)
+            continue;
+          return false;
+        }
+        if (n == 0) {
+          errno = EPROTO;
+          return false;
+        }
+        p += n;
+        size -= ::std::size_t(n);
+      }
+      return true;
+    }
+
+    template <typename T>
+    bool
+    read_header(int fd, Header &h) {
+      if (not read_all(fd, &h, sizeof(h)))
+        return false;
+      if ((h.magic != MAGIC) || (h.item_size != sizeof(T)) ||
+          (h.fingerprint != fingerprint<T>())) {
+        errno = EINVAL;
+        return false;
+      }
+      return true;
+    }
+
+    template <typename T>
+    bool
+    check_count(Header const &h, ::std::size_t size) {
+      constexpr ::std::size_t LIMIT = PTRDIFF_MAX / sizeof(T);
+      if ((h.count > LIMIT) || (size > LIMIT - h.count)) {
+        errno = EOVERFLOW;
+        return false;
+      }
+      return true;
+    }
+  }
+
+  using stream::Header;
+}
+
+#ifdef TTL_ENABLE_TEST
+namespace serialize {
+  namespace stream {
+    namespace {
+      TESTCASE("test serialize stream") {
+        int fds[2];
+        ASSERT(::pipe(fds) == 0);
+
+        SECTION("header") {
+          Header h = header<::std::uint32_t>(3);
+          ASSERT(write_all(fds[1], &h, sizeof(h)));
+          h = header<float>(3);
+          ASSERT(write_all(fds[1], &h, sizeof(h)));
+
+          ASSERT(read_header<::std::uint32_t>(fds[0], h));
+          ASSERT(h.count == 3);
+          errno = 0;
+          ASSERT(not read_header<::std::uint32_t>(fds[0], h));
+          ASSERT(errno == EINVAL);
+        }
+
+        SECTION("gather") {
+          char a[] = "abc", b[] = "", c[] = "defg";
+          ::iovec iov[3] = {{a, 3}, {b, 0}, {c, 4}};
+          ASSERT(write_all(fds[1], iov, 3));
+
+          char buffer[8] = {};
+          ASSERT(read_all(fds[0], buffer, 7));
+          ASSERT(::std::strcmp(buffer, "abcdefg") == 0);
+        }
+
+        SECTION("eof") {
+          ASSERT(write_all(fds[1], "ab", 2));
+          ::close(fds[1]);
+          fds[1] = -1;
+
+          char buffer[4];
+          errno = 0;
+          ASSERT(not read_all(fds[0], buffer, 4));
+          ASSERT(errno == EPROTO);
+        }
+
+        ::close(fds[0]);
+        if (fds[1] >= 0)
+          ::close(fds[1]);
+      }
+    }
+  }
+}
+#endif
+
+#ifdef TTL_ENABLE_BENCH
+namespace serialize {
+  namespace stream {
+    namespace {
+      using ::ttl::test::Bench;
+
+      void
+      throughput(Bench &bench, ::std::size_t bytes) {
+        if (bench.elapsed() > 0)
+          bench.gauge("GB/s",
+                      double(bytes) * bench.iterations / bench.elapsed());
+      }
+    }
+  }
+}
+#endif
@@ -1,3 +1,7 @@
 #include <ttl/storage/system.hpp>
+#include <ttl/storage/instrument.hpp>
 #include <ttl/storage/chunk.hpp>
 #include <ttl/storage/pool.hpp>
+#include <ttl/storage/ipool.hpp>
+#include <ttl/storage/shared.hpp>
+#include <ttl/storage/mapped.hpp>
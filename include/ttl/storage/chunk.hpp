@@ -1,11 +1,29 @@
 namespace storage {
 
-  template <typename T, typename = void> struct Chunk;
+  inline ::std::size_t
+  release_pages(void *begin, void *end) {
+    ::std::uintptr_t page = ::std::uintptr_t(::sysconf(_SC_PAGESIZE));
+    ::std::uintptr_t first = (::std::uintptr_t(begin) + page - 1) & ~(page - 1);
+    ::std::uintptr_t last = ::std::uintptr_t(end) & ~(page - 1);
+    if (first >= last)
+      return 0;
+    if (::madvise(reinterpret_cast<void *>(first), last - first,
+                  MADV_DONTNEED) < 0)
+      return 0;
+    return last - first;
+  }
 
-  template <typename T>
+  template <typename T, typename I = NoInstrumentation, typename = void>
+  struct Chunk;
+
+  template <typename T, typename I>
   struct Chunk<
-      T, typename ::std::enable_if<::std::is_nothrow_move_constructible<
-             T>::value && ::std::is_nothrow_destructible<T>::value>::type> {
+      T, I,
+      ::std::void_t<
+          ::ttl::traits::IMPLEMENTS<I, ::ttl::traits::Instrumentation>,
+          typename ::std::enable_if<::std::is_nothrow_move_constructible<
+              T>::value && ::std::is_nothrow_destructible<T>::value>::type>>
+      : I {
     ::std::size_t capacity;
     T *data;
 
@@ -13,13 +31,16 @@ namespace storage {
     Chunk &
     operator=(Chunk const &) = delete;
 
-    Chunk(Chunk &&o) noexcept : capacity(0), data(nullptr) {
+    Chunk(Chunk &&o) noexcept : I(::std::move(static_cast<I &>(o))),
+                                capacity(0),
+                                data(nullptr) {
       ::std::swap(capacity, o.capacity);
       ::std::swap(data, o.data);
     }
 
     Chunk(::std::size_t capacity)
-        : capacity(capacity)
+        : I()
+        , capacity(capacity)
         , data(nullptr) {
       ::std::size_t size = sizeof(T) * capacity;
       data = static_cast<T *>(::std::malloc(size));
@@ -27,27 +48,68 @@ namespace storage {
 
     void
     resize(::std::size_t new_capacity) {
-      ::std::size_t size = sizeof(T) * new_capacity;
-      data = static_cast<T *>(::std::realloc(data, size));
+      void *ptr = ::ttl::traits::Instrumentation::resize(
+          static_cast<I &>(*this), data, sizeof(T) * capacity,
+          sizeof(T) * new_capacity);
+      if ((ptr == nullptr) && (new_capacity > 0))
+        throw ::std::bad_alloc();
+      data = static_cast<T *>(ptr);
       capacity = new_capacity;
     }
 
+    ::std::size_t
+    purge(::std::size_t used) {
+      CHECK(used <= capacity);
+      if (data == nullptr)
+        return 0;
+      return release_pages(data + used, data + capacity);
+    }
+
+    ::std::size_t
+    usable() const {
+#ifdef __GLIBC__
+      return ::malloc_usable_size(data) / sizeof(T);
+#else
+      return capacity;
+#endif
+    }
+
     T *
     get_ptr(::std::size_t index) {
-      ASSERT(index < capacity);
+      CHECK_FULL(index < capacity);
       return data + index;
     }
 
     T const *
     get_ptr(::std::size_t index) const {
-      ASSERT(index < capacity);
+      CHECK_FULL(index < capacity);
       return data + index;
     }
 
+    template <typename... Args>
     void
-    write(::std::size_t index, T &&item) {
+    emplace(::std::size_t index, Args &&... args) {
       T *ptr = get_ptr(index);
-      new (ptr) T(::std::move(item));
+      new (ptr) T(::std::forward<Args>(args)...);
+    }
+
+    void
+    write(::std::size_t index, T &&item) {
+      emplace(index, ::std::move(item));
+    }
+
+    void
+    destroy(::std::size_t index) {
+      get_ptr(index)->~T();
+    }
+
+    void
+    destroy_n(::std::size_t n) {
+      if (::std::is_trivially_destructible<T>::value)
+        return;
+
+      for (::std::size_t i = 0; i < n; ++i)
+        get_ptr(i)->~T();
     }
 
     T
@@ -74,3 +136,34 @@ namespace storage {
     }
   };
 }
+
+#ifdef TTL_ENABLE_TEST
+namespace storage {
+  namespace chunk {
+    namespace {
+      TESTCASE("test resize counter") {
+        ResizeStats global = ResizeCounter::global();
+        Chunk<::std::size_t, ResizeCounter> chunk(10);
+
+        chunk.resize(20);
+        ASSERT(chunk.stats.resizes == 1);
+        ASSERT(chunk.stats.grows == 1);
+        ASSERT(chunk.stats.shrinks == 0);
+        ASSERT(chunk.stats.bytes_moved ==
+               (chunk.stats.moves ? 10 * sizeof(::std::size_t) : 0));
+
+        chunk.resize(5);
+        ASSERT(chunk.stats.resizes == 2);
+        ASSERT(chunk.stats.grows == 1);
+        ASSERT(chunk.stats.shrinks == 1);
+
+        ASSERT(ResizeCounter::global().resizes == global.resizes + 2);
+        ASSERT(ResizeCounter::global().grows == global.grows + 1);
+        ASSERT(ResizeCounter::global().shrinks == global.shrinks + 1);
+        ASSERT(ResizeCounter::global().bytes_moved - global.bytes_moved ==
+               chunk.stats.bytes_moved);
+      }
+    }
+  }
+}
+#endif
@@ -0,0 +1,97 @@
+namespace storage {
+
+  struct NoInstrumentation {};
+
+  struct ResizeStats {
+    ::std::size_t resizes;
+    ::std::size_t grows;
+    ::std::size_t shrinks;
+    ::std::size_t moves;
+    ::std::size_t bytes_moved;
+    ::std::uint64_t nanoseconds;
+
+    void
+    report(::std::FILE *file, const char *label) const {
+      ::std::fprintf(file,
+                     FORMAT("%s: %`zu resizes (%`zu grows, %`zu shrinks), "
+                            "%`zu moves, %`zu bytes moved, %`64u ns\n"),
+                     label, resizes, grows, shrinks, moves, bytes_moved,
+                     nanoseconds);
+    }
+  };
+
+  struct ResizeCounter {
+    ResizeStats stats;
+
+    ResizeCounter()
+        : stats() {
+    }
+
+    static ResizeStats &
+    global() {
+      static ResizeStats stats;
+      return stats;
+    }
+  };
+}
+
+namespace traits {
+
+  template <> struct Instrumentation::Impl<::ttl::storage::NoInstrumentation> {
+  private:
+    using NoInstrumentation = ::ttl::storage::NoInstrumentation;
+
+  public:
+    static void *
+    resize(NoInstrumentation &, void *ptr, ::std::size_t,
+           ::std::size_t new_size) {
+      return ::std::realloc(ptr, new_size);
+    }
+  };
+
+  template <> struct Instrumentation::Impl<::ttl::storage::ResizeCounter> {
+  private:
+    using ResizeCounter = ::ttl::storage::ResizeCounter;
+    using ResizeStats = ::ttl::storage::ResizeStats;
+    using Clock = ::std::chrono::steady_clock;
+
+    static void
+    record(ResizeStats &stats, ::std::size_t size, ::std::size_t new_size,
+           bool moved, ::std::uint64_t nanoseconds) {
+      __atomic_add_fetch(&stats.resizes, 1, __ATOMIC_RELAXED);
+      if (new_size > size)
+        __atomic_add_fetch(&stats.grows, 1, __ATOMIC_RELAXED);
+      else if (new_size < size)
+        __atomic_add_fetch(&stats.shrinks, 1, __ATOMIC_RELAXED);
+
+      if (moved) {
+        __atomic_add_fetch(&stats.moves, 1, __ATOMIC_RELAXED);
+        __atomic_add_fetch(&stats.bytes_moved, ::std::min(size, new_size),
+                           __ATOMIC_RELAXED);
+      }
+
+      __atomic_add_fetch(&stats.nanoseconds, nanoseconds, __ATOMIC_RELAXED);
+    }
+
+  public:
+    static void *
+    resize(ResizeCounter &self, void *ptr, ::std::size_t size,
+           ::std::size_t new_size) {
+      ::std::uintptr_t old_ptr = reinterpret_cast<::std::uintptr_t>(ptr);
+
+      Clock::time_point start = Clock::now();
+      ptr = ::std::realloc(ptr, new_size);
+      Clock::time_point stop = Clock::now();
+
+      bool moved =
+          (old_ptr != 0) && (old_ptr != reinterpret_cast<::std::uintptr_t>(ptr));
+      ::std::uint64_t nanoseconds =
+          ::std::chrono::duration_cast<::std::chrono::nanoseconds>(stop - start)
+              .count();
+
+      record(self.stats, size, new_size, moved, nanoseconds);
+      record(ResizeCounter::global(), size, new_size, moved, nanoseconds);
+      return ptr;
+    }
+  };
+}
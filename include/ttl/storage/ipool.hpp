@@ -0,0 +1,192 @@
+namespace storage {
+
+  constexpr ::std::uint32_t NIL_INDEX = ~::std::uint32_t(0);
+
+  template <typename T, typename = void> struct IndexPool;
+
+  template <typename T>
+  struct IndexPool<
+      T, typename ::std::enable_if<::std::is_nothrow_move_constructible<
+             T>::value && ::std::is_nothrow_destructible<T>::value>::type> {
+    ::std::uint32_t capacity;
+    ::std::uint32_t next;
+    ::std::uint32_t empty;
+    T *data;
+
+    IndexPool(IndexPool const &) = delete;
+    IndexPool &
+    operator=(IndexPool const &) = delete;
+
+    IndexPool(IndexPool &&o) noexcept : capacity(0),
+                                        next(0),
+                                        empty(NIL_INDEX),
+                                        data(nullptr) {
+      ::std::swap(capacity, o.capacity);
+      ::std::swap(next, o.next);
+      ::std::swap(empty, o.empty);
+      ::std::swap(data, o.data);
+    }
+
+    IndexPool(::std::size_t capacity)
+        : capacity(capacity)
+        , next(0)
+        , empty(NIL_INDEX)
+        , data(nullptr) {
+      CHECK(capacity < NIL_INDEX);
+      data = static_cast<T *>(::std::malloc(
+          ::std::max(sizeof(T), sizeof(::std::uint32_t)) * capacity));
+    }
+
+    T *
+    get_ptr(::std::uint32_t index) {
+      if (sizeof(T) < sizeof(::std::uint32_t)) {
+        return (T *)(((::std::uint32_t *)data) + index);
+      } else {
+        return data + index;
+      }
+    }
+
+    ~IndexPool() {
+      if (data != nullptr)
+        ::std::free(data);
+    }
+  };
+}
+
+namespace traits {
+
+  template <typename T> struct Bounded::Impl<::ttl::storage::IndexPool<T>> {
+  private:
+    using IndexPool = ::ttl::storage::IndexPool<T>;
+
+  public:
+    static ::std::size_t
+    capacity(IndexPool const &self) {
+      return self.capacity;
+    }
+  };
+
+  template <typename T>
+  struct IndexAllocator::Impl<::ttl::storage::IndexPool<T>> {
+  private:
+    using IndexPool = ::ttl::storage::IndexPool<T>;
+
+  public:
+    using Item = T;
+
+    template <typename... Args>
+    static ::std::uint32_t
+    construct(IndexPool &self, Args &&... args) {
+      ::std::uint32_t index;
+      if (self.empty != ::ttl::storage::NIL_INDEX) {
+        index = self.empty;
+        self.empty = *((::std::uint32_t *)self.get_ptr(index));
+      } else {
+        CHECK(self.next < self.capacity);
+        index = self.next++;
+      }
+      new (self.get_ptr(index)) Item(::std::forward<Args>(args)...);
+      return index;
+    }
+
+    static ::std::uint32_t
+    add(IndexPool &self, Item &&item) {
+      return construct(self, ::std::move(item));
+    }
+
+    static void
+    destroy(IndexPool &self, ::std::uint32_t index) {
+      CHECK_FULL(index < self.next);
+      Item *ptr = self.get_ptr(index);
+      ptr->~Item();
+
+      *((::std::uint32_t *)ptr) = self.empty;
+      self.empty = index;
+    }
+
+    static void
+    release_all(IndexPool &self) {
+      self.next = 0;
+      self.empty = ::ttl::storage::NIL_INDEX;
+    }
+
+    static Item
+    remove(IndexPool &self, ::std::uint32_t index) {
+      Item item(::std::move(get(self, index)));
+      destroy(self, index);
+      return item;
+    }
+
+    static Item &
+    get(IndexPool &self, ::std::uint32_t index) {
+      CHECK_FULL(index < self.next);
+      return *self.get_ptr(index);
+    }
+  };
+}
+
+#ifdef TTL_ENABLE_TEST
+namespace storage {
+  namespace ipool {
+    namespace {
+      using ::ttl::test::AssertionFailure;
+      using ::ttl::test::Counter;
+      using ::ttl::traits::IndexAllocator;
+
+      TESTCASE("test index pool") {
+        SECTION("destruction") {
+          IndexPool<Counter> pool(1);
+          Counter::count = 0;
+
+          ::std::uint32_t index = IndexAllocator::add(pool, {});
+          ASSERT(Counter::count == 0);
+
+          {
+            Counter c = IndexAllocator::remove(pool, index);
+            ASSERT(Counter::count == 0);
+          }
+
+          ASSERT(Counter::count == 1);
+
+          index = IndexAllocator::construct(pool);
+          IndexAllocator::destroy(pool, index);
+          ASSERT(Counter::count == 2);
+        }
+
+        SECTION("full") {
+          IndexPool<::std::uint32_t> pool(1);
+          IndexAllocator::add(pool, 1);
+          ASSERT_THROW(AssertionFailure, IndexAllocator::add(pool, 1));
+        }
+
+        SECTION("uint8_t") {
+          IndexPool<::std::uint8_t> pool(3);
+          ::std::uint32_t item1, item2, item3;
+          item1 = IndexAllocator::add(pool, 1);
+          ASSERT(1 == IndexAllocator::get(pool, item1));
+          ASSERT(1 == IndexAllocator::remove(pool, item1));
+          item2 = IndexAllocator::add(pool, 2);
+          ASSERT(item1 == item2);
+
+          item1 = IndexAllocator::add(pool, 1);
+          item3 = IndexAllocator::add(pool, 3);
+          ASSERT(pool.get_ptr(item1) ==
+                 pool.get_ptr(item2) + sizeof(::std::uint32_t));
+          ASSERT(pool.get_ptr(item3) ==
+                 pool.get_ptr(item1) + sizeof(::std::uint32_t));
+
+          IndexAllocator::remove(pool, item1);
+          IndexAllocator::remove(pool, item2);
+          IndexAllocator::remove(pool, item3);
+          ASSERT(item3 == IndexAllocator::add(pool, 3));
+          ASSERT(item2 == IndexAllocator::add(pool, 2));
+          ASSERT(item1 == IndexAllocator::add(pool, 1));
+          ASSERT(1 == IndexAllocator::get(pool, item1));
+          ASSERT(2 == IndexAllocator::get(pool, item2));
+          ASSERT(3 == IndexAllocator::get(pool, item3));
+        }
+      }
+    }
+  }
+}
+#endif
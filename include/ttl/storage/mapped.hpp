@@ -0,0 +1,306 @@
+namespace storage {
+  namespace mapped {
+    using ::ttl::traits::fingerprint;
+
+    static constexpr char MAGIC[8] = {'t', 't', 'l', 'm', 'a', 'p', '1', '\n'};
+    static constexpr ::std::uint32_t VERSION = 1;
+
+    struct alignas(64) Header {
+      char magic[8];
+      ::std::uint32_t version;
+      ::std::uint32_t item_size;
+      ::std::uint64_t fingerprint;
+      ::std::uint64_t size;
+      ::std::uint64_t capacity;
+    };
+
+    inline bool
+    fail(int fd) {
+      int error = errno;
+      ::close(fd);
+      errno = error;
+      return false;
+    }
+
+    template <typename T, typename = void> struct Mapping;
+
+    template <typename T>
+    struct Mapping<T, typename ::std::enable_if<
+                          ::std::is_trivially_copyable<T>::value &&
+                          (alignof(T) <= alignof(Header))>::type> {
+      int fd;
+      Header *header;
+      T *data;
+      ::std::size_t capacity;
+
+      Mapping(Mapping const &) = delete;
+      Mapping &
+      operator=(Mapping const &) = delete;
+
+      Mapping()
+          : fd(-1)
+          , header(nullptr)
+          , data(nullptr)
+          , capacity(0) {
+      }
+
+      Mapping(Mapping &&o) noexcept : fd(-1),
+                                      header(nullptr),
+                                      data(nullptr),
+                                      capacity(0) {
+        ::std::swap(fd, o.fd);
+        ::std::swap(header, o.header);
+        ::std::swap(data, o.data);
+        ::std::swap(capacity, o.capacity);
+      }
+
+      static ::std::size_t
+      length(::std::size_t capacity) {
+        return sizeof(Header) + sizeof(T) * capacity;
+      }
+
+      bool
+      is_open() const {
+        return header != nullptr;
+      }
+
+      bool
+      map(::std::size_t new_capacity) {
+        void *ptr = ::mmap(nullptr, length(new_capacity),
+                           PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (ptr == MAP_FAILED)
+          return false;
+        if (header != nullptr)
+          ::munmap(header, length(capacity));
+        header = static_cast<Header *>(ptr);
+        data = reinterpret_cast<T *>(header + 1);
+        capacity = new_capacity;
+        return true;
+      }
+
+      bool
+      open(char const *path, ::std::size_t initial) {
+        CHECK(not is_open());
+
+        int f = ::open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+        if (f < 0)
+          return false;
+
+        struct stat st;
+        if (::fstat(f, &st) < 0)
+          return fail(f);
+
+        bool created = (st.st_size == 0);
+        if (created && (::ftruncate(f, off_t(length(initial))) < 0))
+          return fail(f);
+        if (not created && (::std::size_t(st.st_size) < sizeof(Header))) {
+          errno = EINVAL;
+          return fail(f);
+        }
+
+        fd = f;
+        if (not map(created ? initial : 0)) {
+          fd = -1;
+          return fail(f);
+        }
+
+        if (created) {
+          ::std::memcpy(header->magic, MAGIC, sizeof(MAGIC));
+          header->version = VERSION;
+          header->item_size = sizeof(T);
+          header->fingerprint = fingerprint<T>();
+          header->size = 0;
+          header->capacity = initial;
+          return true;
+        }
+
+        if ((::std::memcmp(header->magic, MAGIC, sizeof(MAGIC)) != 0) ||
+            (header->version != VERSION) ||
+            (header->item_size != sizeof(T)) ||
+            (header->fingerprint != fingerprint<T>()) ||
+            (header->size > header->capacity) ||
+            (header->capacity >
+             (::std::size_t(-1) - sizeof(Header)) / sizeof(T)) ||
+            (length(header->capacity) != ::std::size_t(st.st_size))) {
+          close();
+          errno = EINVAL;
+          return false;
+        }
+
+        if (not map(header->capacity)) {
+          int error = errno;
+          close();
+          errno = error;
+          return false;
+        }
+        return true;
+      }
+
+      bool
+      resize(::std::size_t new_capacity) {
+        CHECK(is_open());
+        CHECK(new_capacity >= header->size);
+
+        bool grow = (new_capacity > capacity);
+        if (grow && (::ftruncate(fd, off_t(length(new_capacity))) < 0))
+          return false;
+        if (not map(new_capacity)) {
+          int error = errno;
+          if (grow && (::ftruncate(fd, off_t(length(capacity))) < 0))
+            error = errno;
+          errno = error;
+          return false;
+        }
+        header->capacity = new_capacity;
+        return grow || (::ftruncate(fd, off_t(length(new_capacity))) == 0);
+      }
+
+      bool
+      sync() {
+        CHECK(is_open());
+        return ::msync(header, length(capacity), MS_SYNC) == 0;
+      }
+
+      void
+      close() {
+        if (header != nullptr)
+          ::munmap(header, length(capacity));
+        if (fd >= 0)
+          ::close(fd);
+        fd = -1;
+        header = nullptr;
+        data = nullptr;
+        capacity = 0;
+      }
+
+      T *
+      get_ptr(::std::size_t index) {
+        CHECK_FULL(index < capacity);
+        return data + index;
+      }
+
+      T const *
+      get_ptr(::std::size_t index) const {
+        CHECK_FULL(index < capacity);
+        return data + index;
+      }
+
+      T &
+      get(::std::size_t index) {
+        return *get_ptr(index);
+      }
+
+      T const &
+      get(::std::size_t index) const {
+        return *get_ptr(index);
+      }
+
+      ~Mapping() {
+        close();
+      }
+    };
+  }
+
+  using mapped::Mapping;
+}
+
+#ifdef TTL_ENABLE_TEST
+namespace storage {
+  namespace mapped {
+    namespace {
+      using ::ttl::test::AssertionFailure;
+      using ::ttl::test::TempFile;
+
+      struct Point {
+        ::std::uint32_t x;
+        ::std::uint32_t y;
+      };
+
+      TESTCASE("test mapping") {
+        TempFile file;
+
+        SECTION("reopen") {
+          {
+            Mapping<Point> mapping;
+            ASSERT(mapping.open(file.path, 4));
+            ASSERT(mapping.capacity == 4);
+            mapping.get(3) = {3, 4};
+            mapping.header->size = 4;
+            ASSERT(mapping.sync());
+          }
+
+          Mapping<Point> mapping;
+          ASSERT(mapping.open(file.path, 100));
+          ASSERT(mapping.capacity == 4);
+          ASSERT(mapping.header->size == 4);
+          ASSERT(mapping.get(3).x == 3);
+          ASSERT(mapping.get(3).y == 4);
+          ASSERT_THROW(AssertionFailure, mapping.open(file.path, 4));
+        }
+
+        SECTION("resize") {
+          Mapping<Point> mapping;
+          ASSERT(mapping.open(file.path, 2));
+          mapping.get(1) = {1, 2};
+          mapping.header->size = 2;
+
+          ASSERT(mapping.resize(10000));
+          ASSERT(mapping.header->capacity == 10000);
+          ASSERT(mapping.get(1).y == 2);
+          mapping.get(9999) = {5, 6};
+
+          ASSERT(mapping.resize(2));
+          ASSERT(mapping.get(1).y == 2);
+          ASSERT_THROW(AssertionFailure, mapping.resize(1));
+
+          struct stat st;
+          ASSERT(::stat(file.path, &st) == 0);
+          ASSERT(::std::size_t(st.st_size) == Mapping<Point>::length(2));
+        }
+
+        SECTION("mismatch") {
+          {
+            Mapping<Point> mapping;
+            ASSERT(mapping.open(file.path, 4));
+          }
+
+          Mapping<::std::uint64_t> other;
+          errno = 0;
+          ASSERT(not other.open(file.path, 4));
+          ASSERT(errno == EINVAL);
+          ASSERT(not other.is_open());
+
+          {
+            Mapping<Point> mapping;
+            ASSERT(mapping.open(file.path, 4));
+            mapping.header->capacity = 4 + (::std::uint64_t(1) << 61);
+          }
+
+          Mapping<Point> overflow;
+          errno = 0;
+          ASSERT(not overflow.open(file.path, 4));
+          ASSERT(errno == EINVAL);
+          ASSERT(not overflow.is_open());
+
+          ::std::FILE *f = ::std::fopen(file.path, "r+");
+          ::std::fputs("garbage", f);
+          ::std::fclose(f);
+
+          Mapping<Point> mapping;
+          errno = 0;
+          ASSERT(not mapping.open(file.path, 4));
+          ASSERT(errno == EINVAL);
+        }
+
+        SECTION("missing") {
+          Mapping<Point> mapping;
+          errno = 0;
+          ASSERT(not mapping.open("/nonexistent/ttl/mapping", 4));
+          ASSERT(errno == ENOENT);
+          ASSERT(not mapping.is_open());
+        }
+      }
+    }
+  }
+}
+#endif
@@ -6,6 +6,10 @@ namespace storage {
   struct Pool<
       T, typename ::std::enable_if<::std::is_nothrow_move_constructible<
              T>::value && ::std::is_nothrow_destructible<T>::value>::type> {
+    static constexpr ::std::size_t STRIDE =
+        ::std::max(sizeof(T), sizeof(::std::uintptr_t));
+    static constexpr ::std::uintptr_t END = ~::std::uintptr_t(0);
+
     ::std::size_t capacity;
     T *data;
     ::std::size_t next;
@@ -30,8 +34,7 @@ namespace storage {
         , data(nullptr)
         , next(0)
         , empty(nullptr) {
-      data = static_cast<T *>(::std::malloc(
-          ::std::max(sizeof(T), sizeof(::std::uintptr_t)) * capacity));
+      data = static_cast<T *>(::std::malloc(STRIDE * capacity));
     }
 
     T *
@@ -43,6 +46,65 @@ namespace storage {
       }
     }
 
+    T *
+    next_empty(T *ptr) const {
+      ::std::uintptr_t link = *((::std::uintptr_t *)ptr);
+      if (link == END)
+        return nullptr;
+      return (T *)(::std::uintptr_t(ptr) + STRIDE + link);
+    }
+
+    void
+    link_empty(T *ptr, T *next) {
+      *((::std::uintptr_t *)ptr) =
+          (next == nullptr)
+              ? END
+              : ::std::uintptr_t(next) - ::std::uintptr_t(ptr) - STRIDE;
+    }
+
+    ::std::size_t
+    trim() {
+      if (next == 0)
+        return 0;
+
+      ::std::size_t words = (next + 63) / 64;
+      Chunk<::std::uint64_t> bits(words);
+      ::std::memset(bits.data, 0, sizeof(::std::uint64_t) * words);
+      for (T *ptr = empty; ptr != nullptr; ptr = next_empty(ptr)) {
+        ::std::size_t i = ::std::size_t((char *)ptr - (char *)data) / STRIDE;
+        bits.get(i / 64) |= ::std::uint64_t(1) << (i % 64);
+      }
+
+      auto is_free = [&bits](::std::size_t i) {
+        return (bits.get(i / 64) >> (i % 64)) & 1;
+      };
+
+      while ((next > 0) && is_free(next - 1))
+        --next;
+
+      empty = nullptr;
+      for (::std::size_t i = next; i-- > 0;) {
+        if (is_free(i)) {
+          link_empty(get_ptr(i), empty);
+          empty = get_ptr(i);
+        }
+      }
+
+      ::std::size_t released = 0;
+      for (::std::size_t i = 0; i < next;) {
+        if (not is_free(i)) {
+          ++i;
+          continue;
+        }
+        ::std::size_t j = i;
+        while (is_free(j))
+          ++j;
+        released += release_pages(get_ptr(i), get_ptr(j - 1));
+        i = j;
+      }
+      return released + release_pages(get_ptr(next), get_ptr(capacity));
+    }
+
     ~Pool() {
       if (data != nullptr)
         ::std::free(data);
@@ -70,28 +132,92 @@ namespace traits {
   public:
     using Item = T;
 
+    template <typename... Args>
     static Item *
-    add(Pool &self, Item &&item) {
+    construct(Pool &self, Args &&... args) {
       Item *ptr = nullptr;
       if (self.empty != nullptr) {
         ptr = self.empty;
-        self.empty = *((T **)ptr);
+        self.empty = self.next_empty(ptr);
       } else {
-        ASSERT(self.next < self.capacity);
+        CHECK(self.next < self.capacity);
         ptr = self.get_ptr(self.next++);
       }
-      new (ptr) Item(::std::move(item));
+      new (ptr) Item(::std::forward<Args>(args)...);
       return ptr;
     }
 
-    static Item
-    remove(Pool &self, Item *ptr) {
-      ASSERT((ptr >= self.get_ptr(0)) && (ptr < self.get_ptr(self.capacity)));
-      Item item(::std::move(*ptr));
+    static Item *
+    add(Pool &self, Item &&item) {
+      return construct(self, ::std::move(item));
+    }
+
+    static void
+    destroy(Pool &self, Item *ptr) {
+      CHECK_FULL((ptr >= self.get_ptr(0)) &&
+                 (ptr < self.get_ptr(self.capacity)));
       ptr->~Item();
 
-      *((T **)ptr) = self.empty;
+      self.link_empty(ptr, self.empty);
       self.empty = ptr;
+    }
+
+    template <typename F>
+    static void
+    add_n(Pool &self, Item **ptrs, ::std::size_t n, F &&make) {
+      ::std::size_t free = 0;
+      for (Item *ptr = self.empty; (free < n) && (ptr != nullptr);
+           ptr = self.next_empty(ptr))
+        ++free;
+      CHECK(n - free <= self.capacity - self.next);
+
+      ::std::size_t i = 0;
+      for (; i < free; ++i) {
+        ptrs[i] = self.empty;
+        self.empty = self.next_empty(ptrs[i]);
+        new (ptrs[i]) Item(make(i));
+      }
+
+      for (; i < n; ++i) {
+        ptrs[i] = self.get_ptr(self.next++);
+        new (ptrs[i]) Item(make(i));
+      }
+    }
+
+    static void
+    destroy_n(Pool &self, Item **ptrs, ::std::size_t n) {
+      Item *head = self.empty;
+      for (::std::size_t i = n; i-- > 0;) {
+        Item *ptr = ptrs[i];
+        CHECK_FULL((ptr >= self.get_ptr(0)) &&
+                   (ptr < self.get_ptr(self.capacity)));
+        ptr->~Item();
+        self.link_empty(ptr, head);
+        head = ptr;
+      }
+      self.empty = head;
+    }
+
+    template <typename F>
+    static void
+    remove_n(Pool &self, Item **ptrs, ::std::size_t n, F &&take) {
+      for (::std::size_t i = 0; i < n; ++i)
+        take(i, ::std::move(*ptrs[i]));
+      destroy_n(self, ptrs, n);
+    }
+
+    static void
+    release_all(Pool &self) {
+      self.next = 0;
+      self.empty = nullptr;
+    }
+
+    static Item
+    remove(Pool &self, Item *ptr) {
+      CHECK_FULL((ptr >= self.get_ptr(0)) &&
+                 (ptr < self.get_ptr(self.capacity)));
+      Item item(::std::move(*ptr));
+      destroy(self, ptr);
       return item;
     }
   };
@@ -102,11 +228,14 @@ namespace storage {
   namespace pool {
     namespace {
       using ::ttl::test::AssertionFailure;
+      using ::ttl::test::resident_size;
       using ::ttl::traits::Allocator;
       using ::ttl::test::test_allocator_item_destruction;
+      using ::ttl::test::test_allocator_batch;
 
       TESTCASE("test pool") {
         test_allocator_item_destruction<Pool>({1});
+        test_allocator_batch<Pool>({4});
 
         SECTION("full") {
           Pool<::std::size_t> pool(1);
@@ -114,6 +243,112 @@ namespace storage {
           ASSERT_THROW(AssertionFailure, Allocator::add(pool, 1));
         }
 
+        SECTION("release all") {
+          Pool<::std::size_t> pool(2);
+          ::std::size_t *item1 = Allocator::add(pool, 1);
+          Allocator::add(pool, 2);
+          ASSERT(Allocator::releases_all<Pool<::std::size_t>>());
+          Allocator::release_all(pool);
+          ASSERT(item1 == Allocator::add(pool, 3));
+          Allocator::add(pool, 4);
+          ASSERT_THROW(AssertionFailure, Allocator::add(pool, 5));
+        }
+
+        SECTION("batch") {
+          Pool<::std::size_t> pool(4);
+          ::std::size_t *ptrs[4], *again[4];
+          auto make = [](::std::size_t i) { return i; };
+
+          Allocator::add_n(pool, ptrs, 3, make);
+          ASSERT(pool.next == 3);
+          ASSERT(ptrs[1] == ptrs[0] + 1);
+          ASSERT(*ptrs[2] == 2);
+
+          Allocator::destroy_n(pool, ptrs, 2);
+          Allocator::add_n(pool, again, 3, make);
+          ASSERT(again[0] == ptrs[0]);
+          ASSERT(again[1] == ptrs[1]);
+          ASSERT(again[2] == pool.get_ptr(3));
+          ASSERT_THROW(AssertionFailure,
+                       Allocator::add_n(pool, again, 1, make));
+        }
+
+        SECTION("trim") {
+          Pool<::std::size_t> pool(8);
+          ::std::size_t *ptrs[8];
+          for (::std::size_t i = 0; i < 8; ++i)
+            ptrs[i] = Allocator::add(pool, ::std::move(i));
+          for (::std::size_t i : {6, 1, 7, 3, 5})
+            Allocator::destroy(pool, ptrs[i]);
+
+          pool.trim();
+          ASSERT(pool.next == 5);
+          ASSERT(Allocator::add(pool, 10) == ptrs[1]);
+          ASSERT(Allocator::add(pool, 11) == ptrs[3]);
+          ASSERT(Allocator::add(pool, 12) == ptrs[5]);
+          ASSERT(Allocator::add(pool, 13) == ptrs[6]);
+          ASSERT(*ptrs[4] == 4);
+
+          Pool<::std::size_t> empty(8);
+          ASSERT(empty.trim() == 0);
+        }
+
+        SECTION("trim rss") {
+          struct Block {
+            ::std::size_t words[8];
+          };
+          constexpr ::std::size_t N = 1 << 18;
+          constexpr ::std::size_t KEEP = 4096;
+
+          Pool<Block> pool(N);
+          Chunk<Block *> ptrs(N);
+          for (::std::size_t i = 0; i < N; ++i)
+            ptrs.get(i) = Allocator::add(pool, {{i}});
+
+          ::std::size_t before = resident_size();
+          for (::std::size_t i = 0; i < N; ++i)
+            if (i % KEEP != 0)
+              Allocator::destroy(pool, ptrs.get(i));
+
+          ::std::size_t released = pool.trim();
+          ::std::size_t after = resident_size();
+          ASSERT(released >= sizeof(Block) * N * 15 / 16);
+          ASSERT(pool.next == N - KEEP + 1);
+          if (before > 0) {
+            ASSERT(before >= after + released / 2);
+          }
+
+          for (::std::size_t i = 0; i < N; i += KEEP)
+            ASSERT(ptrs.get(i)->words[0] == i);
+          for (::std::size_t i = 0; i < N; ++i) {
+            if (i % KEEP != 0) {
+              ASSERT(Allocator::add(pool, {{i}}) == ptrs.get(i));
+            }
+          }
+          ASSERT_THROW(AssertionFailure, Allocator::add(pool, {}));
+        }
+
+        SECTION("batch uint8_t") {
+          Pool<::std::uint8_t> pool(4);
+          ::std::uint8_t *ptrs[4];
+          auto make = [](::std::size_t i) { return ::std::uint8_t(i); };
+
+          Allocator::add_n(pool, ptrs, 4, make);
+          for (::std::size_t i = 0; i < 4; ++i) {
+            ASSERT(ptrs[i] == pool.get_ptr(i));
+            ASSERT(*ptrs[i] == i);
+          }
+
+          Allocator::destroy_n(pool, ptrs, 2);
+          ASSERT(*ptrs[2] == 2);
+          ASSERT(*ptrs[3] == 3);
+          ASSERT_THROW(AssertionFailure,
+                       Allocator::add_n(pool, ptrs, 3, make));
+          Allocator::add_n(pool, ptrs, 2, make);
+          ASSERT(ptrs[0] == pool.get_ptr(0));
+          ASSERT(ptrs[1] == pool.get_ptr(1));
+        }
+
         SECTION("uintptr_t") {
           Pool<::std::uintptr_t> pool(3);
           ::std::uintptr_t *item1, *item2, *item3;
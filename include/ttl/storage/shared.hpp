@@ -0,0 +1,113 @@
+namespace storage {
+
+  template <typename A, typename = void> struct Shared;
+
+  template <typename A>
+  struct Shared<A, ::ttl::traits::IMPLEMENTS<A, ::ttl::traits::Allocator>> {
+    A *allocator;
+
+    Shared(Shared const &) = delete;
+    Shared &
+    operator=(Shared const &) = delete;
+
+    Shared(Shared &&) = default;
+
+    Shared(A &allocator)
+        : allocator(&allocator) {
+    }
+  };
+}
+
+namespace traits {
+
+  template <typename A>
+  struct Allocator::Impl<::ttl::storage::Shared<A>> {
+  private:
+    using Shared = ::ttl::storage::Shared<A>;
+
+  public:
+    using Item = typename Allocator::Impl<A>::Item;
+
+    template <typename... Args>
+    static Item *
+    construct(Shared &self, Args &&... args) {
+      return Allocator::construct(*self.allocator,
+                                  ::std::forward<Args>(args)...);
+    }
+
+    static Item *
+    add(Shared &self, Item &&item) {
+      return Allocator::add(*self.allocator, ::std::move(item));
+    }
+
+    static void
+    destroy(Shared &self, Item *ptr) {
+      Allocator::destroy(*self.allocator, ptr);
+    }
+
+    static Item
+    remove(Shared &self, Item *ptr) {
+      return Allocator::remove(*self.allocator, ptr);
+    }
+
+    template <typename F>
+    static void
+    add_n(Shared &self, Item **ptrs, ::std::size_t n, F &&make) {
+      Allocator::add_n(*self.allocator, ptrs, n, make);
+    }
+
+    template <typename F>
+    static void
+    remove_n(Shared &self, Item **ptrs, ::std::size_t n, F &&take) {
+      Allocator::remove_n(*self.allocator, ptrs, n, take);
+    }
+
+    static void
+    destroy_n(Shared &self, Item **ptrs, ::std::size_t n) {
+      Allocator::destroy_n(*self.allocator, ptrs, n);
+    }
+
+    static bool
+    shares(Shared const &self, Shared const &other) {
+      return Allocator::shares(*self.allocator, *other.allocator);
+    }
+  };
+}
+
+#ifdef TTL_ENABLE_TEST
+namespace storage {
+  namespace shared {
+    namespace {
+      using ::ttl::test::AssertionFailure;
+      using ::ttl::test::Counter;
+      using ::ttl::traits::Allocator;
+
+      TESTCASE("test shared allocator") {
+        SECTION("forwarding") {
+          Pool<Counter> pool(2);
+          Shared<Pool<Counter>> a(pool), b(pool);
+          Counter::count = 0;
+
+          Counter *ptr = Allocator::construct(a);
+          Allocator::destroy(b, ptr);
+          ASSERT(Counter::count == 1);
+          ASSERT(Allocator::construct(b) == ptr);
+
+          Allocator::add(a, {});
+          ASSERT_THROW(AssertionFailure, Allocator::add(b, {}));
+        }
+
+        SECTION("shares") {
+          Pool<Counter> pool(1), other(1);
+          Shared<Pool<Counter>> a(pool), b(pool), c(other);
+          ASSERT(Allocator::shares(a, b));
+          ASSERT(not Allocator::shares(a, c));
+          ASSERT(Allocator::shares(pool, pool));
+          ASSERT(not Allocator::shares(pool, other));
+          ASSERT(not Allocator::releases_all<Shared<Pool<Counter>>>());
+        }
+      }
+    }
+  }
+}
+#endif
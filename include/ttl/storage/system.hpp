@@ -24,20 +24,36 @@ namespace traits {
   public:
     using Item = T;
 
+    template <typename... Args>
     static Item *
-    add(SystemAllocator &, Item &&item) {
+    construct(SystemAllocator &, Args &&... args) {
       Item *ptr = static_cast<Item *>(::std::malloc(sizeof(Item)));
-      new (ptr) Item(::std::move(item));
+      new (ptr) Item(::std::forward<Args>(args)...);
       return ptr;
     }
 
-    static Item
-    remove(SystemAllocator &, Item *ptr) {
-      Item item(::std::move(*ptr));
+    static Item *
+    add(SystemAllocator &self, Item &&item) {
+      return construct(self, ::std::move(item));
+    }
+
+    static void
+    destroy(SystemAllocator &, Item *ptr) {
       ptr->~Item();
       ::std::free(ptr);
+    }
+
+    static Item
+    remove(SystemAllocator &self, Item *ptr) {
+      Item item(::std::move(*ptr));
+      destroy(self, ptr);
       return item;
     }
+
+    static bool
+    shares(SystemAllocator const &, SystemAllocator const &) {
+      return true;
+    }
   };
 }
 
@@ -46,9 +62,11 @@ namespace storage {
   namespace system {
     namespace {
       using ::ttl::test::test_allocator_item_destruction;
+      using ::ttl::test::test_allocator_batch;
 
       TESTCASE("test system allocator") {
         test_allocator_item_destruction<SystemAllocator>({});
+        test_allocator_batch<SystemAllocator>({});
       }
     }
   }
@@ -19,5 +19,37 @@ namespace test {
     }
 
     ASSERT(Counter::count == 1);
+
+    Counter::moves = 0;
+    ptr = Allocator::construct(allocator);
+    ASSERT(Counter::moves == 0);
+    Allocator::destroy(allocator, ptr);
+    ASSERT(Counter::count == 2);
+    ASSERT(Counter::moves == 0);
+  }
+
+  template <template <typename...> typename T>
+  IMPLEMENTS<T<Counter>, Allocator>
+  test_allocator_batch(T<Counter> &&allocator) {
+    Counter *ptrs[4];
+    Counter::count = 0;
+
+    Allocator::add_n(allocator, ptrs, 4,
+                     [](::std::size_t) { return Counter(); });
+    ASSERT(Counter::count == 0);
+    for (Counter *ptr : ptrs)
+      ASSERT(ptr->valid);
+
+    ::std::size_t taken = 0;
+    Allocator::remove_n(allocator, ptrs, 2,
+                        [&taken](::std::size_t i, Counter &&c) {
+                          Counter owned(::std::move(c));
+                          taken += i + 1;
+                        });
+    ASSERT(taken == 3);
+    ASSERT(Counter::count == 2);
+
+    Allocator::destroy_n(allocator, ptrs + 2, 2);
+    ASSERT(Counter::count == 4);
   }
 }
@@ -0,0 +1,669 @@
+namespace test {
+  template <typename T>
+  inline void
+  do_not_optimize(T const &value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+  }
+
+  inline void
+  clobber() {
+    asm volatile("" : : : "memory");
+  }
+
+  struct Random {
+    ::std::uint64_t state;
+
+    Random(::std::uint64_t seed = 0x9e3779b97f4a7c15)
+        : state(seed) {
+    }
+
+    ::std::uint64_t
+    next() {
+      state ^= state >> 12;
+      state ^= state << 25;
+      state ^= state >> 27;
+      return state * 0x2545f4914f6cdd1d;
+    }
+  };
+
+  struct TempFile {
+    char path[32];
+
+    TempFile(TempFile const &) = delete;
+    TempFile &
+    operator=(TempFile const &) = delete;
+
+    TempFile() {
+      ::std::strcpy(path, "/tmp/ttl-XXXXXX");
+      int fd = ::mkstemp(path);
+      if (fd >= 0)
+        ::close(fd);
+    }
+
+    ~TempFile() {
+      ::unlink(path);
+    }
+  };
+
+  struct Allocations {
+    static ::std::size_t count;
+    static ::std::size_t bytes;
+
+    static void
+    record(::std::size_t size) {
+      __atomic_add_fetch(&count, 1, __ATOMIC_RELAXED);
+      __atomic_add_fetch(&bytes, size, __ATOMIC_RELAXED);
+    }
+
+    static ::std::size_t
+    current() {
+      return __atomic_load_n(&count, __ATOMIC_RELAXED);
+    }
+  };
+
+  ::std::size_t Allocations::count = 0;
+  ::std::size_t Allocations::bytes = 0;
+
+  inline ::std::size_t
+  resident_size() {
+#ifdef __linux__
+    ::std::FILE *file = ::std::fopen("/proc/self/statm", "r");
+    if (file == NULL)
+      return 0;
+
+    unsigned long size = 0, resident = 0;
+    int n = ::std::fscanf(file, "%lu %lu", &size, &resident);
+    ::std::fclose(file);
+
+    if (n != 2)
+      return 0;
+    return resident * ::sysconf(_SC_PAGESIZE);
+#else
+    return 0;
+#endif
+  }
+
+  struct BenchCounter {
+    const char *name;
+    double value;
+    bool per_op;
+  };
+
+  struct LatencyHistogram {
+    static constexpr ::std::size_t SUB_BITS = 4;
+    static constexpr ::std::size_t SUB_BUCKETS = 1u << SUB_BITS;
+    static constexpr ::std::size_t BUCKETS = 64 * SUB_BUCKETS;
+
+    ::std::uint64_t counts[BUCKETS];
+    ::std::uint64_t total;
+    ::std::uint64_t max;
+
+    LatencyHistogram()
+        : counts()
+        , total(0)
+        , max(0) {
+    }
+
+    static ::std::size_t
+    bucket(::std::uint64_t value) {
+      if (value < SUB_BUCKETS)
+        return value;
+      ::std::size_t shift = 63 - __builtin_clzll(value) - SUB_BITS;
+      return (shift + 1) * SUB_BUCKETS + ((value >> shift) - SUB_BUCKETS);
+    }
+
+    static ::std::uint64_t
+    upper_bound(::std::size_t index) {
+      if (index < SUB_BUCKETS)
+        return index;
+      ::std::size_t shift = index / SUB_BUCKETS - 1;
+      ::std::uint64_t sub = index % SUB_BUCKETS + SUB_BUCKETS;
+      return ((sub + 1) << shift) - 1;
+    }
+
+    void
+    record(::std::uint64_t value) {
+      counts[bucket(value)] += 1;
+      total += 1;
+      max = ::std::max(max, value);
+    }
+
+    ::std::uint64_t
+    percentile(double p) const {
+      ::std::uint64_t target = ::std::uint64_t(total * p / 100.0 + 0.5);
+      ::std::uint64_t seen = 0;
+
+      for (::std::size_t i = 0; i < BUCKETS; ++i) {
+        seen += counts[i];
+        if ((seen > 0) && (seen >= target))
+          return ::std::min(upper_bound(i), max);
+      }
+      return max;
+    }
+  };
+
+  struct Bench {
+    static constexpr ::std::size_t MAX_COUNTERS = 4;
+    static constexpr ::std::size_t MAX_ITERATIONS = 1000000000;
+
+    ::std::size_t iterations;
+    ::std::size_t arg;
+    ::std::size_t ops;
+    Clock::time_point start, stop;
+    ::std::size_t allocations;
+    ::std::size_t rss;
+    BenchCounter counters[MAX_COUNTERS];
+    ::std::size_t ncounters;
+
+    struct Iterator {
+      Bench &bench;
+      ::std::size_t index;
+
+      ::std::size_t
+      operator*() const {
+        return index;
+      }
+
+      Iterator &
+      operator++() {
+        ++index;
+        return *this;
+      }
+
+      bool
+      operator!=(Iterator const &o) {
+        if (index != o.index)
+          return true;
+        bench.stop = Clock::now();
+        bench.allocations = Allocations::current() - bench.allocations;
+        bench.rss = ::std::max(resident_size(), bench.rss) - bench.rss;
+        return false;
+      }
+    };
+
+    Bench(::std::size_t iterations, ::std::size_t arg)
+        : iterations(iterations)
+        , arg(arg)
+        , ops(1)
+        , start()
+        , stop()
+        , allocations(0)
+        , rss(0)
+        , counters()
+        , ncounters(0) {
+    }
+
+    void
+    counter(const char *name, double value) {
+      if (ncounters < MAX_COUNTERS)
+        counters[ncounters++] = {name, value, true};
+    }
+
+    void
+    gauge(const char *name, double value) {
+      if (ncounters < MAX_COUNTERS)
+        counters[ncounters++] = {name, value, false};
+    }
+
+    Iterator
+    begin() {
+      rss = resident_size();
+      allocations = Allocations::current();
+      start = Clock::now();
+      return {*this, 0};
+    }
+
+    Iterator
+    end() {
+      return {*this, iterations};
+    }
+
+    bool
+    finished() const {
+      return stop != Clock::time_point();
+    }
+
+    ::std::uint64_t
+    elapsed() const {
+      if (stop < start)
+        return 0;
+      return ::std::chrono::duration_cast<::std::chrono::nanoseconds>(stop -
+                                                                      start)
+          .count();
+    }
+  };
+
+  inline Bench
+  sample(void (*f)(Bench &), ::std::size_t iterations, ::std::size_t arg) {
+    Bench bench(iterations, arg);
+    f(bench);
+    return bench;
+  }
+
+  inline ::std::size_t
+  calibrate(void (*f)(Bench &), ::std::size_t arg,
+            ::std::uint64_t sample_time) {
+    ::std::size_t iterations = 1;
+
+    while (true) {
+      Bench bench = sample(f, iterations, arg);
+      if (not bench.finished())
+        return 0;
+
+      ::std::uint64_t elapsed = bench.elapsed();
+      if ((elapsed >= sample_time) || (iterations >= Bench::MAX_ITERATIONS))
+        return iterations;
+
+      ::std::size_t scale = 10;
+      if (elapsed > 0)
+        scale = ::std::min(::std::size_t(10),
+                           ::std::size_t(sample_time * 1.2 / elapsed) + 1);
+      iterations = ::std::min(iterations * scale, Bench::MAX_ITERATIONS);
+    }
+  }
+
+  struct Summary {
+    double min;
+    double median;
+    double p99;
+  };
+
+  inline Summary
+  summarize(double *samples, ::std::size_t n) {
+    ::std::sort(samples, samples + n);
+    ::std::size_t p99 = (n * 99 + 99) / 100;
+    return {samples[0], (n % 2) ? samples[n / 2]
+                                : (samples[n / 2 - 1] + samples[n / 2]) / 2,
+            samples[(p99 > 0) ? p99 - 1 : 0]};
+  }
+
+  enum class BenchFormat { TEXT, JSON, CSV };
+
+  struct BenchOptions {
+    static constexpr ::std::size_t MAX_SAMPLES = 1000;
+
+    BenchFormat format;
+    const char *filter;
+    ::std::size_t samples;
+    ::std::uint64_t sample_time;
+    ::std::size_t max_size;
+
+    BenchOptions()
+        : format(BenchFormat::TEXT)
+        , filter(NULL)
+        , samples(30)
+        , sample_time(10000000)
+        , max_size(1000000) {
+    }
+  };
+
+  struct BenchResult {
+    ::std::size_t arg;
+    ::std::size_t iterations;
+    ::std::size_t ops;
+    ::std::size_t samples;
+    Summary ns;
+    double allocations;
+    ::std::size_t rss;
+    BenchCounter counters[Bench::MAX_COUNTERS];
+    ::std::size_t ncounters;
+    bool skipped;
+  };
+
+  struct Benchmark {
+    static Benchmark *first, *last;
+    Benchmark *prev, *next;
+    const char *file;
+    const int line;
+    const char *desc;
+    void (*const f)(Bench &);
+    const ::std::size_t lo, hi;
+    bool (*const available)();
+
+    Benchmark(const char *file, int line, const char *desc,
+              void (*f)(Bench &), ::std::size_t lo = 0, ::std::size_t hi = 0,
+              bool (*available)() = NULL)
+        : prev(last)
+        , next(NULL)
+        , file(file)
+        , line(line)
+        , desc(desc)
+        , f(f)
+        , lo(lo)
+        , hi(hi)
+        , available(available) {
+      if (!first)
+        first = this;
+      if (last)
+        last->next = this;
+      last = this;
+    }
+
+    BenchResult
+    run(BenchOptions const &options, ::std::size_t arg) const {
+      double samples[BenchOptions::MAX_SAMPLES];
+      ::std::size_t n = ::std::min(options.samples, BenchOptions::MAX_SAMPLES);
+      ::std::size_t iterations = 0;
+      if ((available == NULL) || available())
+        iterations = calibrate(f, arg, options.sample_time);
+      if (iterations == 0)
+        return {arg, 0, 0, 0, {}, 0, 0, {}, 0, true};
+
+      Bench warmup = sample(f, iterations, arg);
+      ::std::size_t rss = warmup.rss;
+
+      for (::std::size_t i = 0; i < n; ++i) {
+        Bench bench = sample(f, iterations, arg);
+        samples[i] = double(bench.elapsed()) / (iterations * bench.ops);
+        rss = ::std::max(rss, bench.rss);
+      }
+
+      BenchResult result = {arg,
+                            iterations,
+                            warmup.ops,
+                            n,
+                            summarize(samples, n),
+                            double(warmup.allocations) /
+                                (iterations * warmup.ops),
+                            rss,
+                            {},
+                            warmup.ncounters,
+                            false};
+
+      for (::std::size_t i = 0; i < warmup.ncounters; ++i) {
+        result.counters[i] = warmup.counters[i];
+        if (warmup.counters[i].per_op)
+          result.counters[i].value /= iterations * warmup.ops;
+      }
+
+      return result;
+    }
+  };
+
+  constexpr ::std::size_t LatencyHistogram::SUB_BUCKETS;
+  constexpr ::std::size_t Bench::MAX_COUNTERS;
+  constexpr ::std::size_t Bench::MAX_ITERATIONS;
+  constexpr ::std::size_t BenchOptions::MAX_SAMPLES;
+  Benchmark *Benchmark::first = NULL;
+  Benchmark *Benchmark::last = NULL;
+
+  inline void
+  print_json_counters(BenchResult const &r, bool per_op) {
+    bool first = true;
+    for (::std::size_t i = 0; i < r.ncounters; ++i) {
+      if (r.counters[i].per_op != per_op)
+        continue;
+      printf("%s", first ? "" : ", ");
+      print_json_string(r.counters[i].name);
+      printf(": %.6g", r.counters[i].value);
+      first = false;
+    }
+  }
+
+  inline void
+  print_csv_counters(BenchResult const &r, bool per_op) {
+    bool first = true;
+    for (::std::size_t i = 0; i < r.ncounters; ++i) {
+      if (r.counters[i].per_op != per_op)
+        continue;
+      printf("%s%s=%.6g", first ? "" : ";", r.counters[i].name,
+             r.counters[i].value);
+      first = false;
+    }
+  }
+
+  inline void
+  print_bench_header(BenchFormat format) {
+    switch (format) {
+    case BenchFormat::TEXT:
+      printf("%-40s %10s %12s %12s %12s %10s %10s %11s\n", "benchmark", "arg",
+             "min ns/op", "median ns/op", "p99 ns/op", "allocs/op", "rss KiB",
+             "iterations");
+      break;
+    case BenchFormat::JSON:
+      printf("[");
+      break;
+    case BenchFormat::CSV:
+      printf("name,file,line,arg,iterations,ops,samples,min_ns,median_ns,"
+             "p99_ns,allocs_per_op,rss_bytes,counters_per_op,gauges\n");
+      break;
+    }
+  }
+
+  inline void
+  print_bench_skipped(BenchFormat format, Benchmark const &b,
+                      BenchResult const &r, bool first) {
+    switch (format) {
+    case BenchFormat::TEXT:
+      printf(FORMAT("%-40s %10`zu %12s\n"), b.desc, r.arg, "skipped");
+      break;
+    case BenchFormat::JSON:
+      printf("%s\n  {\"name\": ", first ? "" : ",");
+      print_json_string(b.desc);
+      printf(", \"file\": ");
+      print_json_string(b.file);
+      printf(FORMAT(", \"line\": %d, \"arg\": %`zu, \"skipped\": true}"),
+             b.line, r.arg);
+      break;
+    case BenchFormat::CSV:
+      printf(FORMAT("\"%s\",%s,%d,%`zu,0,0,0,,,,,,\"\",\"\"\n"), b.desc,
+             b.file, b.line, r.arg);
+      break;
+    }
+  }
+
+  inline void
+  print_bench_result(BenchFormat format, Benchmark const &b,
+                     BenchResult const &r, bool first) {
+    if (r.skipped)
+      return print_bench_skipped(format, b, r, first);
+
+    switch (format) {
+    case BenchFormat::TEXT:
+      printf(FORMAT("%-40s %10`zu %12.2f %12.2f %12.2f %10.3f %10`zu %11`zu"),
+             b.desc, r.arg, r.ns.min, r.ns.median, r.ns.p99, r.allocations,
+             r.rss / 1024, r.iterations);
+      for (::std::size_t i = 0; i < r.ncounters; ++i)
+        printf(r.counters[i].per_op ? "  %s=%.4g/op" : "  %s=%.4g",
+               r.counters[i].name, r.counters[i].value);
+      printf("\n");
+      break;
+    case BenchFormat::JSON:
+      printf("%s\n  {\"name\": ", first ? "" : ",");
+      print_json_string(b.desc);
+      printf(", \"file\": ");
+      print_json_string(b.file);
+      printf(FORMAT(", \"line\": %d, \"arg\": %`zu, \"iterations\": %`zu, "
+                    "\"ops\": %`zu, \"samples\": %`zu, \"min_ns\": %.3f, "
+                    "\"median_ns\": %.3f, \"p99_ns\": %.3f, "
+                    "\"allocs_per_op\": %.3f, \"rss_bytes\": %`zu, "
+                    "\"counters_per_op\": {"),
+             b.line, r.arg, r.iterations, r.ops, r.samples, r.ns.min,
+             r.ns.median, r.ns.p99, r.allocations, r.rss);
+      print_json_counters(r, true);
+      printf("}, \"gauges\": {");
+      print_json_counters(r, false);
+      printf("}}");
+      break;
+    case BenchFormat::CSV:
+      printf(FORMAT("\"%s\",%s,%d,%`zu,%`zu,%`zu,%`zu,%.3f,%.3f,%.3f,%.3f,"
+                    "%`zu,\""),
+             b.desc, b.file, b.line, r.arg, r.iterations, r.ops, r.samples,
+             r.ns.min, r.ns.median, r.ns.p99, r.allocations, r.rss);
+      print_csv_counters(r, true);
+      printf("\",\"");
+      print_csv_counters(r, false);
+      printf("\"\n");
+      break;
+    }
+  }
+
+  inline void
+  print_bench_footer(BenchFormat format) {
+    if (format == BenchFormat::JSON)
+      printf("\n]\n");
+  }
+
+  inline bool
+  parse_bench_options(BenchOptions &options, int argc, char *argv[]) {
+    for (int i = 1; i < argc; ++i) {
+      const char *arg = argv[i];
+
+      if (!::std::strcmp(arg, "--json")) {
+        options.format = BenchFormat::JSON;
+      } else if (!::std::strcmp(arg, "--csv")) {
+        options.format = BenchFormat::CSV;
+      } else if (!::std::strncmp(arg, "--samples=", 10)) {
+        options.samples = ::std::strtoul(arg + 10, NULL, 10);
+      } else if (!::std::strncmp(arg, "--sample-time=", 14)) {
+        options.sample_time = ::std::strtoull(arg + 14, NULL, 10) * 1000;
+      } else if (!::std::strncmp(arg, "--max-size=", 11)) {
+        options.max_size = ::std::strtoul(arg + 11, NULL, 10);
+      } else if (arg[0] != '-') {
+        options.filter = arg;
+      } else {
+        fprintf(stderr,
+                "usage: %s [--json|--csv] [--samples=N] "
+                "[--sample-time=USEC] [--max-size=N] [FILTER]\n",
+                argv[0]);
+        return false;
+      }
+    }
+
+    if ((options.samples == 0) || (options.sample_time == 0)) {
+      fprintf(stderr, "%s: samples and sample time must be positive\n",
+              argv[0]);
+      return false;
+    }
+
+    return true;
+  }
+
+  bool
+  run_benchmarks(int argc, char *argv[]) {
+    BenchOptions options;
+    if (!parse_bench_options(options, argc, argv))
+      return false;
+
+    bool first = true;
+    print_bench_header(options.format);
+
+    for (Benchmark *p = Benchmark::first; p; p = p->next) {
+      if (options.filter && !::std::strstr(p->desc, options.filter))
+        continue;
+
+      for (::std::size_t arg = p->lo;
+           (arg <= p->hi) && (arg <= options.max_size); arg *= 10) {
+        print_bench_result(options.format, *p, p->run(options, arg), first);
+        fflush(stdout);
+        first = false;
+
+        if (arg == 0)
+          break;
+      }
+    }
+
+    print_bench_footer(options.format);
+    return true;
+  }
+}
+
+#define _TTLTEST_BENCHMARK(x, desc)                                            \
+  static void _TTLTEST_NAME(func, x)(::ttl::test::Bench &);                    \
+  static ::ttl::test::Benchmark _TTLTEST_NAME(benchmark, x)(                   \
+      __FILE__, __LINE__, (desc), _TTLTEST_NAME(func, x));                     \
+  void _TTLTEST_NAME(func, x)(::ttl::test::Bench & bench)
+
+#define _TTLTEST_BENCHMARK_RANGE(x, desc, lo, hi)                              \
+  static void _TTLTEST_NAME(func, x)(::ttl::test::Bench &);                    \
+  static ::ttl::test::Benchmark _TTLTEST_NAME(benchmark, x)(                   \
+      __FILE__, __LINE__, (desc), _TTLTEST_NAME(func, x), (lo), (hi));         \
+  void _TTLTEST_NAME(func, x)(::ttl::test::Bench & bench)
+
+#define _TTLTEST_BENCHMARK_RANGE_IF(x, desc, lo, hi, cond)                    \
+  static void _TTLTEST_NAME(func, x)(::ttl::test::Bench &);                    \
+  static bool _TTLTEST_NAME(available, x)() { return (cond); }                 \
+  static ::ttl::test::Benchmark _TTLTEST_NAME(benchmark, x)(                   \
+      __FILE__, __LINE__, (desc), _TTLTEST_NAME(func, x), (lo), (hi),          \
+      _TTLTEST_NAME(available, x));                                            \
+  void _TTLTEST_NAME(func, x)(::ttl::test::Bench & bench)
+
+#define BENCHMARK(desc) _TTLTEST_BENCHMARK(__COUNTER__, (desc))
+#define BENCHMARK_RANGE(desc, lo, hi)                                          \
+  _TTLTEST_BENCHMARK_RANGE(__COUNTER__, (desc), (lo), (hi))
+#define BENCHMARK_RANGE_IF(desc, lo, hi, cond)                                 \
+  _TTLTEST_BENCHMARK_RANGE_IF(__COUNTER__, (desc), (lo), (hi), (cond))
+
+#ifdef TTL_ENABLE_TEST
+namespace test {
+  namespace bench {
+    namespace {
+      void
+      empty_benchmark(Bench &bench) {
+        for (::std::size_t i : bench)
+          do_not_optimize(i);
+      }
+
+      void
+      idle_benchmark(Bench &) {
+      }
+
+      TESTCASE("test benchmark") {
+        SECTION("summarize") {
+          double samples[] = {5, 1, 4, 2, 3};
+          Summary s = summarize(samples, 5);
+          ASSERT(s.min == 1);
+          ASSERT(s.median == 3);
+          ASSERT(s.p99 == 5);
+        }
+
+        SECTION("latency histogram") {
+          LatencyHistogram h;
+          for (::std::uint64_t i = 1; i <= 1000; ++i)
+            h.record(i);
+
+          ASSERT(h.total == 1000);
+          ASSERT(h.max == 1000);
+          ASSERT(h.percentile(100) == 1000);
+          ASSERT(h.percentile(50) >= 500);
+          ASSERT(h.percentile(50) <= 532);
+          ASSERT(h.percentile(1) == 10);
+
+          for (::std::uint64_t i = 0; i < 1u << 20; ++i) {
+            ::std::size_t index = LatencyHistogram::bucket(i);
+            ASSERT(index < LatencyHistogram::BUCKETS);
+            ASSERT(i <= LatencyHistogram::upper_bound(index));
+            ASSERT(index == LatencyHistogram::bucket(
+                                LatencyHistogram::upper_bound(index)));
+          }
+        }
+
+        SECTION("calibrate") {
+          ::std::size_t iterations = calibrate(empty_benchmark, 0, 100000);
+          ASSERT(iterations > 1);
+          ASSERT(sample(empty_benchmark, iterations, 0).elapsed() > 0);
+        }
+
+        SECTION("skipped") {
+          ASSERT(calibrate(idle_benchmark, 0, 100000) == 0);
+          ASSERT(not sample(idle_benchmark, 1, 0).finished());
+          ASSERT(sample(empty_benchmark, 1, 0).finished());
+        }
+      }
+    }
+  }
+}
+#endif
+
+#ifdef TTL_ENABLE_BENCH
+namespace test {
+  namespace bench {
+    namespace {
+      BENCHMARK("bench overhead") {
+        for (::std::size_t i : bench)
+          do_not_optimize(i);
+      }
+    }
+  }
+}
+#endif
@@ -0,0 +1,386 @@
+namespace test {
+  namespace compare {
+    using ::ttl::traits::Stack;
+    using ::ttl::traits::List;
+    using ::ttl::traits::Append;
+
+    using Small = ::std::uint32_t;
+
+    struct Large {
+      ::std::uint64_t value[8];
+
+      Large(::std::uint64_t v)
+          : value{v} {
+      }
+    };
+
+    struct Moving {
+      ::std::uint64_t value;
+
+      Moving(::std::uint64_t v)
+          : value(v) {
+      }
+
+      Moving(Moving &&o) noexcept : value(o.value) {
+        o.value = 0;
+      }
+
+      Moving(Moving const &) = delete;
+      Moving &
+      operator=(Moving const &) = delete;
+    };
+
+    struct Expensive {
+      ::std::uint64_t value[32];
+
+      Expensive(::std::uint64_t v)
+          : value{v} {
+      }
+
+      Expensive(Expensive &&o) noexcept {
+        ::std::copy(o.value, o.value + 32, value);
+        o.value[0] = 0;
+      }
+
+      Expensive &
+      operator=(Expensive &&o) noexcept {
+        ::std::copy(o.value, o.value + 32, value);
+        o.value[0] = 0;
+        return *this;
+      }
+
+      Expensive(Expensive const &) = delete;
+      Expensive &
+      operator=(Expensive const &) = delete;
+    };
+
+    inline ::std::uint64_t
+    key(Small const &item) {
+      return item;
+    }
+
+    inline ::std::uint64_t
+    key(Large const &item) {
+      return item.value[0];
+    }
+
+    inline ::std::uint64_t
+    key(Moving const &item) {
+      return item.value;
+    }
+
+    inline ::std::uint64_t
+    key(Expensive const &item) {
+      return item.value[0];
+    }
+
+    template <typename C> struct Locked {
+      ::std::mutex mutex;
+      C data;
+
+      template <typename... Args>
+      Locked(Args &&... args)
+          : mutex()
+          , data(::std::forward<Args>(args)...) {
+      }
+    };
+
+    template <typename C, typename T>
+    void
+    push(C &c, T &&item) {
+      Stack::push(c, ::std::move(item));
+    }
+
+    template <typename T>
+    void
+    push(::std::vector<T> &c, T &&item) {
+      c.push_back(::std::move(item));
+    }
+
+    template <typename T>
+    void
+    push(::std::deque<T> &c, T &&item) {
+      c.push_back(::std::move(item));
+    }
+
+    template <typename T>
+    void
+    push(::std::forward_list<T> &c, T &&item) {
+      c.push_front(::std::move(item));
+    }
+
+    template <typename C, typename T>
+    void
+    append(C &c, T &&item) {
+      Append::append(c, ::std::move(item));
+    }
+
+    template <typename C, typename T>
+    void
+    append(Locked<C> &c, T &&item) {
+      ::std::lock_guard<::std::mutex> guard(c.mutex);
+      Stack::push(c.data, ::std::move(item));
+    }
+
+    template <typename C>
+    ::std::uint64_t
+    pop(C &c) {
+      return key(Stack::pop(c));
+    }
+
+    template <typename T>
+    ::std::uint64_t
+    pop(::std::vector<T> &c) {
+      T item(::std::move(c.back()));
+      c.pop_back();
+      return key(item);
+    }
+
+    template <typename T>
+    ::std::uint64_t
+    pop(::std::deque<T> &c) {
+      T item(::std::move(c.back()));
+      c.pop_back();
+      return key(item);
+    }
+
+    template <typename T>
+    ::std::uint64_t
+    pop(::std::forward_list<T> &c) {
+      T item(::std::move(c.front()));
+      c.pop_front();
+      return key(item);
+    }
+
+    template <typename C>
+    void
+    clear(C &c) {
+      Stack::clear(c);
+    }
+
+    template <typename T>
+    void
+    clear(::std::vector<T> &c) {
+      c.clear();
+      c.shrink_to_fit();
+    }
+
+    template <typename T>
+    void
+    clear(::std::deque<T> &c) {
+      c.clear();
+      c.shrink_to_fit();
+    }
+
+    template <typename T>
+    void
+    clear(::std::forward_list<T> &c) {
+      c.clear();
+    }
+
+    template <typename C>
+    ::std::uint64_t
+    get(C const &c, ::std::size_t index) {
+      return key(List::get(c, index));
+    }
+
+    template <typename T>
+    ::std::uint64_t
+    get(::std::vector<T> const &c, ::std::size_t index) {
+      return key(c[index]);
+    }
+
+    template <typename T>
+    ::std::uint64_t
+    get(::std::deque<T> const &c, ::std::size_t index) {
+      return key(c[index]);
+    }
+
+    template <typename T, typename C>
+    void
+    bench_push_pop(Bench &bench, C &&c) {
+      bench.ops = 2 * bench.arg;
+
+      for (::std::size_t i : bench) {
+        for (::std::size_t j = 0; j < bench.arg; ++j)
+          push(c, T(i + j));
+        for (::std::size_t j = 0; j < bench.arg; ++j)
+          do_not_optimize(pop(c));
+      }
+    }
+
+    template <typename T, typename C>
+    void
+    bench_push_clear(Bench &bench, C &&c) {
+      bench.ops = bench.arg;
+
+      for (::std::size_t i : bench) {
+        for (::std::size_t j = 0; j < bench.arg; ++j)
+          push(c, T(i + j));
+        clear(c);
+      }
+    }
+
+    template <typename T, typename C>
+    void
+    bench_push_latency(Bench &bench, C &&c) {
+      LatencyHistogram histogram;
+      bench.ops = bench.arg;
+
+      for (::std::size_t i : bench) {
+        for (::std::size_t j = 0; j < bench.arg; ++j) {
+          Clock::time_point start = Clock::now();
+          push(c, T(i + j));
+          Clock::time_point stop = Clock::now();
+          histogram.record(
+              ::std::chrono::duration_cast<::std::chrono::nanoseconds>(stop -
+                                                                       start)
+                  .count());
+        }
+        clear(c);
+      }
+
+      bench.gauge("p99 ns", histogram.percentile(99));
+      bench.gauge("p99.99 ns", histogram.percentile(99.99));
+      bench.gauge("max ns", histogram.max);
+    }
+
+    template <typename T, typename C>
+    void
+    bench_emplace_drop(Bench &bench, C &&c) {
+      bench.ops = 2 * bench.arg;
+
+      for (::std::size_t i : bench) {
+        for (::std::size_t j = 0; j < bench.arg; ++j)
+          Stack::emplace(c, i + j);
+        for (::std::size_t j = 0; j < bench.arg; ++j)
+          Stack::drop(c);
+      }
+    }
+
+    template <typename T, typename C>
+    void
+    bench_emplace_pop_into(Bench &bench, C &&c) {
+      T item(0);
+      bench.ops = 2 * bench.arg;
+
+      for (::std::size_t i : bench) {
+        for (::std::size_t j = 0; j < bench.arg; ++j)
+          Stack::emplace(c, i + j);
+        for (::std::size_t j = 0; j < bench.arg; ++j) {
+          Stack::pop_into(c, item);
+          do_not_optimize(key(item));
+        }
+      }
+    }
+
+    template <typename T, typename C, typename... Args>
+    void
+    bench_append(Bench &bench, Args... args) {
+      constexpr ::std::size_t THREADS = 4;
+      bench.ops = bench.arg;
+
+      for (::std::size_t i : bench) {
+        C c(args...);
+        ::std::thread threads[THREADS];
+
+        for (::std::size_t t = 0; t < THREADS; ++t)
+          threads[t] = ::std::thread([&c, &bench, i, t] {
+            for (::std::size_t j = t; j < bench.arg; j += THREADS)
+              append(c, T(i + j));
+          });
+
+        for (::std::size_t t = 0; t < THREADS; ++t)
+          threads[t].join();
+      }
+    }
+
+    template <typename T, typename C>
+    void
+    bench_get(Bench &bench, C &&c) {
+      for (::std::size_t j = 0; j < bench.arg; ++j)
+        push(c, T(j));
+
+      bench.ops = bench.arg;
+
+      for (::std::size_t i : bench) {
+        ::std::uint64_t sum = i;
+        for (::std::size_t j = 0; j < bench.arg; ++j)
+          sum += get(c, j);
+        do_not_optimize(sum);
+      }
+    }
+
+    template <typename A, typename D, typename H, typename R>
+    void
+    bench_guard(Bench &bench, R read) {
+      A allocator{};
+      D domain(allocator);
+      H handle(domain);
+      ::std::atomic<typename H::Item *> shared(domain.construct(0));
+      bench.ops = bench.arg;
+
+      for (::std::size_t i : bench) {
+        ::std::uint64_t sum = i;
+        for (::std::size_t j = 0; j < bench.arg; ++j)
+          sum += read(handle, shared);
+        do_not_optimize(sum);
+      }
+
+      ::ttl::traits::Allocator::destroy(allocator, shared.load());
+    }
+
+    template <typename A, typename D, typename H, typename R>
+    void
+    bench_retire(Bench &bench, R read) {
+      constexpr ::std::size_t READERS = 2;
+      A allocator{};
+      D domain(allocator);
+      ::std::atomic<typename H::Item *> shared(domain.construct(0));
+      ::std::atomic<bool> done(false);
+      LatencyHistogram histogram;
+      ::std::size_t pending = 0;
+      bench.ops = bench.arg;
+
+      ::std::thread readers[READERS];
+      for (::std::thread &reader : readers)
+        reader = ::std::thread([&] {
+          H handle(domain);
+          ::std::uint64_t sum = 0;
+          while (not done.load(::std::memory_order_relaxed))
+            sum += read(handle, shared);
+          do_not_optimize(sum);
+        });
+
+      {
+        H handle(domain);
+        for (::std::size_t i : bench) {
+          for (::std::size_t j = 0; j < bench.arg; ++j) {
+            handle.retire(shared.exchange(domain.construct(i + j)));
+            pending = ::std::max(pending, handle.retired.size);
+          }
+
+          Clock::time_point start = Clock::now();
+          while (not Stack::is_empty(handle.retired)) {
+            domain.collect(handle);
+            ::std::this_thread::yield();
+          }
+          Clock::time_point stop = Clock::now();
+          histogram.record(
+              ::std::chrono::duration_cast<::std::chrono::nanoseconds>(stop -
+                                                                       start)
+                  .count());
+        }
+      }
+
+      done.store(true);
+      for (::std::thread &reader : readers)
+        reader.join();
+
+      ::ttl::traits::Allocator::destroy(allocator, shared.load());
+      bench.gauge("max pending", pending);
+      bench.gauge("drain p99 ns", histogram.percentile(99));
+      bench.gauge("drain max ns", histogram.max);
+    }
+  }
+}
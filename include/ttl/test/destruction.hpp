@@ -1,6 +1,7 @@
 namespace test {
   struct Counter {
     static ::std::size_t count;
+    static ::std::size_t moves;
     bool valid;
 
     Counter()
@@ -8,6 +9,7 @@ namespace test {
     }
 
     Counter(Counter &&o) noexcept : valid(false) {
+      moves++;
       ::std::swap(valid, o.valid);
     }
 
@@ -25,4 +27,32 @@ namespace test {
   };
 
   ::std::size_t Counter::count = 0;
+  ::std::size_t Counter::moves = 0;
+
+  struct Tracked {
+    static constexpr ::std::uint64_t ALIVE = 0x616c697665u;
+    volatile ::std::uint64_t magic;
+
+    Tracked()
+        : magic(ALIVE) {
+    }
+
+    Tracked(Tracked &&) noexcept : magic(ALIVE) {
+    }
+
+    Tracked(Tracked const &) = delete;
+    Tracked &
+    operator=(Tracked const &) = delete;
+
+    bool
+    is_alive() const {
+      return magic == ALIVE;
+    }
+
+    ~Tracked() {
+      magic = 0;
+    }
+  };
+
+  constexpr ::std::uint64_t Tracked::ALIVE;
 }
@@ -1,4 +1,5 @@
 namespace test {
+  using ::ttl::traits::Collection;
   using ::ttl::traits::Stack;
   using ::ttl::traits::Bounded;
   using ::ttl::traits::Unbounded;
@@ -24,6 +25,67 @@ namespace test {
     ASSERT(Counter::count == 10);
   }
 
+  template <template <typename...> typename T>
+  IMPLEMENTS<T<Counter>, Stack>
+  test_stack_emplace(T<Counter> &&stack) {
+    Counter::count = 0;
+    Counter::moves = 0;
+
+    {
+      T<Counter> s{::std::move(stack)};
+
+      for (::std::size_t i = 0; i < 10; ++i)
+        Stack::emplace(s);
+
+      for (::std::size_t i = 0; i < 5; ++i) {
+        Stack::drop(s);
+        ASSERT(Counter::count == i + 1);
+      }
+
+      ASSERT(Counter::moves == 0);
+    }
+
+    ASSERT(Counter::count == 10);
+  }
+
+  template <template <typename...> typename T>
+  IMPLEMENTS<T<Counter>, Stack>
+  test_stack_clear(T<Counter> &&s) {
+    Counter::count = 0;
+
+    for (::std::size_t i = 0; i < 10; ++i)
+      Stack::emplace(s);
+
+    Stack::clear(s);
+    ASSERT(Counter::count == 10);
+    ASSERT(Stack::is_empty(s));
+    ASSERT(Collection::size(s) == 0);
+
+    Stack::emplace(s);
+    ASSERT(not Stack::is_empty(s));
+    Stack::clear(s);
+    ASSERT(Counter::count == 11);
+  }
+
+  template <template <typename...> typename T>
+  IMPLEMENTS<T<::std::size_t>, Stack>
+  test_stack_pop_into(T<::std::size_t> &&s) {
+    ::std::size_t item = 0;
+
+    for (::std::size_t i = 0; i < 5; i++)
+      Stack::emplace(s, i);
+
+    for (::std::size_t i = 0; i < 5; i++) {
+      Stack::pop_into(s, item);
+      ASSERT(item == 4 - i);
+    }
+
+    ASSERT(Stack::is_empty(s));
+
+    ASSERT_THROW(AssertionFailure, Stack::pop_into(s, item));
+    ASSERT_THROW(AssertionFailure, Stack::drop(s));
+  }
+
   template <template <typename...> typename T>
   IMPLEMENTS<T<::std::size_t>, Stack>
   test_stack(T<::std::size_t> &&s) {
@@ -1,4 +1,5 @@
 namespace test {
+  using Clock = ::std::chrono::steady_clock;
 
   struct AssertionFailure {
     const char *const format;
@@ -22,6 +23,10 @@ namespace test {
     const char *const desc;
     bool done;
     bool entered;
+    bool listed;
+    Section *sibling;
+    double elapsed;
+    ::std::size_t runs;
 
     Section(const char *file, int line, const char *desc)
         : prev(NULL)
@@ -30,8 +35,15 @@ namespace test {
         , line(line)
         , desc(desc)
         , done(false)
-        , entered(false) {
+        , entered(false)
+        , listed(false)
+        , sibling(NULL)
+        , elapsed(0)
+        , runs(0) {
     }
+
+    void
+    record(double seconds, ::std::size_t n);
   };
 
   struct State {
@@ -47,6 +59,7 @@ namespace test {
 
   struct Cond {
     static State state;
+    static Section *listed;
     Section &section;
 
     Cond(Section &section)
@@ -86,6 +99,25 @@ namespace test {
     }
   };
 
+  inline void
+  Section::record(double seconds, ::std::size_t n) {
+    if (!listed) {
+      listed = true;
+      sibling = Cond::listed;
+      Cond::listed = this;
+    }
+    elapsed += seconds;
+    runs += n;
+  }
+
+  struct SectionReport {
+    const char *file;
+    int line;
+    const char *desc;
+    double elapsed;
+    ::std::size_t runs;
+  };
+
   using ::std::fprintf;
   using ::std::free;
 
@@ -96,6 +128,12 @@ namespace test {
     const int line;
     const char *desc;
     void (*const f)();
+    bool passed;
+    double elapsed;
+    SectionReport *sections;
+    ::std::size_t nsections;
+    ::ttl::profile::Sample counters;
+    char *output;
 
     TestCase(const char *file, int line, const char *desc, void (*f)())
         : prev(last)
@@ -103,7 +141,13 @@ namespace test {
         , file(file)
         , line(line)
         , desc(desc)
-        , f(f) {
+        , f(f)
+        , passed(false)
+        , elapsed(0)
+        , sections(NULL)
+        , nsections(0)
+        , counters()
+        , output(NULL) {
       if (!first)
         first = this;
       if (last)
@@ -130,12 +174,25 @@ namespace test {
                 (p == state.current) ? "-> " : "", p->file, p->line, p->desc);
     }
 
+    static Section *
+    leaf(State const &state) {
+      Section *p = state.first;
+      while (p && p->next)
+        p = p->next;
+      return p;
+    }
+
     bool
     run() {
       bool failed = false;
+      Cond::listed = NULL;
+      ::ttl::profile::Counters &perf = ::ttl::profile::thread_counters();
+      ::ttl::profile::Sample begin = perf.read();
+      Clock::time_point start = Clock::now();
 
       while (true) {
         Cond::state = State();
+        Clock::time_point begin = Clock::now();
 
         try {
           f();
@@ -147,7 +204,7 @@ namespace test {
         } catch (const ::std::exception &e) {
           failed = true;
           print_exception_name();
-          printf("  %s\n", e.what());
+          fprintf(stderr, "  %s\n", e.what());
           print_state(Cond::state);
         } catch (...) {
           failed = true;
@@ -155,28 +212,430 @@ namespace test {
           print_state(Cond::state);
         }
 
+        if (Section *section = leaf(Cond::state))
+          section->record(
+              ::std::chrono::duration<double>(Clock::now() - begin).count(),
+              1);
+
         if (!Cond::state.done)
           break;
       }
 
-      return !failed;
+      elapsed = ::std::chrono::duration<double>(Clock::now() - start).count();
+      counters = ::ttl::profile::difference(perf.read(), begin);
+      passed = !failed;
+      collect(Cond::listed);
+      return passed;
+    }
+
+    void
+    collect(Section *list) {
+      nsections = 0;
+      for (Section *p = list; p; p = p->sibling)
+        nsections += 1;
+
+      sections = static_cast<SectionReport *>(
+          ::std::malloc(sizeof(SectionReport) * nsections));
+      ::std::size_t i = nsections;
+      for (Section *p = list; p; p = p->sibling)
+        sections[--i] = {p->file, p->line, p->desc, p->elapsed, p->runs};
     }
   };
 
   State Cond::state;
+  Section *Cond::listed = NULL;
   TestCase *TestCase::first = NULL;
   TestCase *TestCase::last = NULL;
 
+  enum class TestFormat { TEXT, JSON, JUNIT };
+
+  struct TestOptions {
+    static constexpr ::std::size_t MAX_PATTERNS = 32;
+    static constexpr ::std::size_t MAX_JOBS = 64;
+
+    TestFormat format;
+    const char *patterns[MAX_PATTERNS];
+    ::std::size_t npatterns;
+    ::std::size_t jobs;
+    bool verbose;
+    bool list;
+
+    TestOptions()
+        : format(TestFormat::TEXT)
+        , patterns()
+        , npatterns(0)
+        , jobs(1)
+        , verbose(false)
+        , list(false) {
+    }
+
+    bool
+    matches(TestCase const &test) const {
+      if (npatterns == 0)
+        return true;
+      for (::std::size_t i = 0; i < npatterns; ++i)
+        if (!::fnmatch(patterns[i], test.desc, 0))
+          return true;
+      return false;
+    }
+  };
+
+  constexpr ::std::size_t TestOptions::MAX_PATTERNS;
+  constexpr ::std::size_t TestOptions::MAX_JOBS;
+
+  inline char *
+  read_file(FILE *file) {
+    fflush(file);
+    long size = ftell(file);
+    char *text = static_cast<char *>(::std::malloc(size + 1));
+    rewind(file);
+    size = fread(text, 1, size, file);
+    text[size] = 0;
+    return text;
+  }
+
+  inline void
+  run_captured(TestCase &test) {
+    FILE *output = tmpfile();
+    if (!output) {
+      test.run();
+      return;
+    }
+
+    fflush(stdout);
+    fflush(stderr);
+    int saved = dup(2);
+    dup2(fileno(output), 2);
+    test.run();
+    fflush(stderr);
+    dup2(saved, 2);
+    close(saved);
+
+    test.output = read_file(output);
+    fclose(output);
+    fputs(test.output, stderr);
+  }
+
+  struct Worker {
+    pid_t pid;
+    TestCase *test;
+    FILE *output;
+    FILE *report;
+  };
+
+  inline bool
+  start_worker(Worker &worker, TestCase &test) {
+    worker.test = &test;
+    worker.output = tmpfile();
+    worker.report = tmpfile();
+    if (!worker.output || !worker.report)
+      return false;
+
+    fflush(stdout);
+    fflush(stderr);
+    worker.pid = fork();
+    if (worker.pid != 0)
+      return worker.pid > 0;
+
+    dup2(fileno(worker.output), 1);
+    dup2(fileno(worker.output), 2);
+    test.run();
+    fwrite(&test.passed, sizeof(test.passed), 1, worker.report);
+    fwrite(&test.elapsed, sizeof(test.elapsed), 1, worker.report);
+    fwrite(&test.counters, sizeof(test.counters), 1, worker.report);
+    fwrite(&test.nsections, sizeof(test.nsections), 1, worker.report);
+    fwrite(test.sections, sizeof(SectionReport), test.nsections,
+           worker.report);
+    fflush(NULL);
+    _exit(0);
+  }
+
+  inline void
+  finish_worker(Worker &worker, int status) {
+    TestCase &test = *worker.test;
+    rewind(worker.report);
+    bool complete =
+        (fread(&test.passed, sizeof(test.passed), 1, worker.report) == 1) &&
+        (fread(&test.elapsed, sizeof(test.elapsed), 1, worker.report) == 1) &&
+        (fread(&test.counters, sizeof(test.counters), 1, worker.report) ==
+         1) &&
+        (fread(&test.nsections, sizeof(test.nsections), 1, worker.report) ==
+         1);
+
+    if (complete) {
+      test.sections = static_cast<SectionReport *>(
+          ::std::malloc(sizeof(SectionReport) * test.nsections));
+      complete = fread(test.sections, sizeof(SectionReport), test.nsections,
+                       worker.report) == test.nsections;
+    }
+    if (!complete)
+      test.nsections = 0;
+
+    if (!complete || !WIFEXITED(status) || WEXITSTATUS(status)) {
+      test.passed = false;
+      if (WIFSIGNALED(status))
+        fprintf(worker.output, "%s:%d: %s: terminated by signal %d\n",
+                test.file, test.line, test.desc, WTERMSIG(status));
+      else
+        fprintf(worker.output, "%s:%d: %s: worker exited abnormally\n",
+                test.file, test.line, test.desc);
+    }
+
+    fseek(worker.output, 0, SEEK_END);
+    test.output = read_file(worker.output);
+    fclose(worker.output);
+    fclose(worker.report);
+    fputs(test.output, stderr);
+  }
+
+  inline bool
+  run_parallel(TestOptions const &options) {
+    Worker workers[TestOptions::MAX_JOBS];
+    ::std::size_t running = 0;
+    TestCase *p = TestCase::first;
+
+    while (true) {
+      for (; p && (running < options.jobs); p = p->next) {
+        if (!options.matches(*p))
+          continue;
+        if (!start_worker(workers[running], *p)) {
+          fprintf(stderr, "%s: cannot start worker\n", p->desc);
+          return false;
+        }
+        running += 1;
+      }
+
+      if (running == 0)
+        return true;
+
+      int status = 0;
+      pid_t pid = waitpid(-1, &status, 0);
+      if (pid < 0)
+        return false;
+
+      for (::std::size_t i = 0; i < running; ++i) {
+        if (workers[i].pid != pid)
+          continue;
+        finish_worker(workers[i], status);
+        workers[i] = workers[--running];
+        break;
+      }
+    }
+  }
+
+  inline void
+  print_json_string(const char *s) {
+    putchar('"');
+    for (; *s; ++s) {
+      if ((*s == '"') || (*s == '\\'))
+        printf("\\%c", *s);
+      else if (*s == '\n')
+        printf("\\n");
+      else if ((unsigned char)*s < 0x20)
+        printf("\\u%04x", (unsigned char)*s);
+      else
+        putchar(*s);
+    }
+    putchar('"');
+  }
+
+  inline void
+  print_xml_string(const char *s) {
+    for (; *s; ++s) {
+      if (*s == '&')
+        printf("&amp;");
+      else if (*s == '<')
+        printf("&lt;");
+      else if (*s == '>')
+        printf("&gt;");
+      else if (*s == '"')
+        printf("&quot;");
+      else if (((unsigned char)*s < 0x20) && (*s != '\n') && (*s != '\t'))
+        printf("&#%d;", *s);
+      else
+        putchar(*s);
+    }
+  }
+
+  inline void
+  print_test_report(TestOptions const &options) {
+    ::std::size_t tests = 0, failures = 0;
+    double elapsed = 0;
+    bool first = true;
+    for (TestCase *p = TestCase::first; p; p = p->next) {
+      if (!options.matches(*p))
+        continue;
+      tests += 1;
+      failures += !p->passed;
+      elapsed += p->elapsed;
+    }
+
+    switch (options.format) {
+    case TestFormat::TEXT:
+      if (!options.verbose)
+        break;
+      for (TestCase *p = TestCase::first; p; p = p->next) {
+        if (!options.matches(*p))
+          continue;
+        printf("%s %10.3f ms  %s\n", p->passed ? "ok  " : "FAIL",
+               p->elapsed * 1000, p->desc);
+        if (p->counters.available) {
+          printf("%17s", "");
+          ::ttl::profile::print(stdout, p->counters);
+          printf("\n");
+        }
+        for (SectionReport *s = p->sections; s < p->sections + p->nsections;
+             ++s)
+          printf("     %10.3f ms    %s (%zu runs)\n",
+                 s->elapsed * 1000, s->desc, s->runs);
+      }
+      printf("%zu tests, %zu failed, %.3f s\n", tests, failures, elapsed);
+      break;
+    case TestFormat::JSON:
+      printf("[");
+      for (TestCase *p = TestCase::first; p; p = p->next) {
+        if (!options.matches(*p))
+          continue;
+        printf("%s\n  {\"name\": ", first ? "" : ",");
+        first = false;
+        print_json_string(p->desc);
+        printf(", \"file\": ");
+        print_json_string(p->file);
+        printf(", \"line\": %d, \"passed\": %s, \"seconds\": %.6f, "
+               "\"sections\": [",
+               p->line, p->passed ? "true" : "false", p->elapsed);
+        for (SectionReport *s = p->sections; s < p->sections + p->nsections;
+             ++s) {
+          printf("%s{\"name\": ", (s == p->sections) ? "" : ", ");
+          print_json_string(s->desc);
+          printf(", \"line\": %d, \"runs\": %zu, \"seconds\": %.6f}",
+                 s->line, s->runs, s->elapsed);
+        }
+        printf("], \"counters\": {");
+        for (::std::size_t i = 0, n = 0; i < ::ttl::profile::EVENTS; ++i)
+          if ((p->counters.available >> i) & 1)
+            printf("%s\"%s\": %llu", n++ ? ", " : "",
+                   ::ttl::profile::EVENT_NAMES[i],
+                   (unsigned long long)p->counters.values[i]);
+        printf("}, \"output\": ");
+        print_json_string(p->output ? p->output : "");
+        printf("}");
+      }
+      printf("\n]\n");
+      break;
+    case TestFormat::JUNIT:
+      printf("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+             "<testsuite name=\"ttl\" tests=\"%zu\" failures=\"%zu\" "
+             "time=\"%.6f\">\n",
+             tests, failures, elapsed);
+      for (TestCase *p = TestCase::first; p; p = p->next) {
+        if (!options.matches(*p))
+          continue;
+        printf("  <testcase classname=\"");
+        print_xml_string(p->file);
+        printf("\" name=\"");
+        print_xml_string(p->desc);
+        printf("\" time=\"%.6f\">\n", p->elapsed);
+        if (!p->passed) {
+          printf("    <failure message=\"test failed\">");
+          print_xml_string(p->output ? p->output : "");
+          printf("</failure>\n");
+        }
+        if (p->nsections) {
+          printf("    <system-out>");
+          for (SectionReport *s = p->sections;
+               s < p->sections + p->nsections; ++s) {
+            printf("%.3f ms ", s->elapsed * 1000);
+            print_xml_string(s->desc);
+            printf(" (%zu runs)\n", s->runs);
+          }
+          printf("</system-out>\n");
+        }
+        printf("  </testcase>\n");
+      }
+      printf("</testsuite>\n");
+      break;
+    }
+  }
+
+  inline bool
+  parse_test_options(TestOptions &options, int argc, char *argv[]) {
+    for (int i = 1; i < argc; ++i) {
+      const char *arg = argv[i];
+
+      if (!::std::strcmp(arg, "--json")) {
+        options.format = TestFormat::JSON;
+      } else if (!::std::strcmp(arg, "--junit")) {
+        options.format = TestFormat::JUNIT;
+      } else if (!::std::strcmp(arg, "--verbose") ||
+                 !::std::strcmp(arg, "-v")) {
+        options.verbose = true;
+      } else if (!::std::strcmp(arg, "--list")) {
+        options.list = true;
+      } else if (!::std::strncmp(arg, "--jobs=", 7)) {
+        options.jobs = ::std::strtoul(arg + 7, NULL, 10);
+      } else if (!::std::strncmp(arg, "-j", 2) && arg[2]) {
+        options.jobs = ::std::strtoul(arg + 2, NULL, 10);
+      } else if (!::std::strcmp(arg, "-j") && (i + 1 < argc)) {
+        options.jobs = ::std::strtoul(argv[++i], NULL, 10);
+      } else if ((arg[0] != '-') &&
+                 (options.npatterns < TestOptions::MAX_PATTERNS)) {
+        options.patterns[options.npatterns++] = arg;
+      } else {
+        fprintf(stderr,
+                "usage: %s [--json|--junit] [--verbose] [--list] "
+                "[-j N|--jobs=N] [PATTERN...]\n",
+                argv[0]);
+        return false;
+      }
+    }
+
+    if ((options.jobs == 0) || (options.jobs > TestOptions::MAX_JOBS)) {
+      fprintf(stderr, "%s: jobs must be between 1 and %zu\n", argv[0],
+              TestOptions::MAX_JOBS);
+      return false;
+    }
+
+    return true;
+  }
+
   bool
-  run_tests() {
-    bool failed = false;
+  run_tests(int argc, char *argv[]) {
+    TestOptions options;
+    if (!parse_test_options(options, argc, argv))
+      return false;
+
+    if (options.list) {
+      for (TestCase *p = TestCase::first; p; p = p->next)
+        if (options.matches(*p))
+          printf("%s\n", p->desc);
+      return true;
+    }
 
+    if (options.jobs > 1) {
+      if (!run_parallel(options))
+        return false;
+    } else {
+      for (TestCase *p = TestCase::first; p; p = p->next)
+        if (options.matches(*p))
+          run_captured(*p);
+    }
+
+    print_test_report(options);
+
+    bool failed = false;
     for (TestCase *p = TestCase::first; p; p = p->next)
-      if (!(p->run()))
+      if (options.matches(*p) && !p->passed)
         failed = true;
-
     return not failed;
   }
+
+  bool
+  run_tests() {
+    char name[] = "test";
+    char *argv[] = {name, NULL};
+    return run_tests(1, argv);
+  }
 }
 
 #define _TTLTEST_NAME(s, x) __ttltest_##s##x
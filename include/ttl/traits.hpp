@@ -1,3 +1,4 @@
 #include <ttl/traits/common.hpp>
 #include <ttl/traits/storage.hpp>
 #include <ttl/traits/collections.hpp>
+#include <ttl/traits/serialize.hpp>
@@ -19,14 +19,21 @@ namespace traits {
 
     template <typename T>
     static ::std::size_t
-    grow(::std::size_t capacity) {
-      return Impl<T>::grow(capacity);
+    grow(T &self, ::std::size_t capacity) {
+      return Impl<T>::grow(self, capacity);
     }
 
     template <typename T>
     static ::std::size_t
-    shrink(::std::size_t size, ::std::size_t capacity) {
-      return Impl<T>::shrink(size, capacity);
+    shrink(T &self, ::std::size_t size, ::std::size_t capacity) {
+      return Impl<T>::shrink(self, size, capacity);
+    }
+
+    template <typename T>
+    static auto
+    fit(T &self, ::std::size_t capacity, ::std::size_t usable)
+        -> decltype(Impl<T>::fit(self, capacity, usable)) {
+      return Impl<T>::fit(self, capacity, usable);
     }
 
     template <typename T>
@@ -58,7 +65,7 @@ namespace traits {
     template <typename T, typename = void> struct Impl;
 
     template <typename T>
-    static typename T::Item const &
+    static typename Impl<T>::Item const &
     get(T const &self, ::std::size_t index) {
       return Impl<T>::get(self, index);
     }
@@ -75,14 +82,14 @@ namespace traits {
     template <typename T, typename = void> struct Impl;
 
     template <typename T>
-    static typename T::Item &
+    static typename Impl<T>::Item &
     get(T &self, ::std::size_t index) {
       return Impl<T>::get(self, index);
     }
 
     template <typename T>
     static void
-    set(T &self, ::std::size_t index, typename T::Item &&item) {
+    set(T &self, ::std::size_t index, typename Impl<T>::Item &&item) {
       Impl<T>::get(self, index) = ::std::move(item);
     }
 
@@ -94,6 +101,46 @@ namespace traits {
             decltype(Impl<T>::get), decltype(get<T>)>::value>::type>;
   };
 
+  struct Contiguous {
+    template <typename T, typename = void> struct Impl;
+
+    template <typename T>
+    static typename Impl<T>::Item *
+    data(T &self) {
+      return Impl<T>::data(self);
+    }
+
+    template <typename T>
+    constexpr static auto
+    REQUIRE() -> ::std::void_t<
+        IMPLEMENTS<T, ListMut>, typename Impl<T>::Item,
+        typename ::std::enable_if<::std::is_same<
+            decltype(Impl<T>::data), decltype(data<T>)>::value>::type>;
+  };
+
+  struct Append {
+    template <typename T, typename = void> struct Impl;
+
+    template <typename T, typename... Args>
+    static ::std::size_t
+    emplace(T &self, Args &&... args) {
+      return Impl<T>::emplace(self, ::std::forward<Args>(args)...);
+    }
+
+    template <typename T>
+    static ::std::size_t
+    append(T &self, typename Impl<T>::Item &&item) {
+      return Impl<T>::append(self, ::std::move(item));
+    }
+
+    template <typename T>
+    constexpr static auto
+    REQUIRE() -> ::std::void_t<
+        IMPLEMENTS<T, Collection>, typename Impl<T>::Item,
+        typename ::std::enable_if<::std::is_same<
+            decltype(Impl<T>::append), decltype(append<T>)>::value>::type>;
+  };
+
   struct Stack {
     template <typename T, typename = void> struct Impl;
 
@@ -109,12 +156,36 @@ namespace traits {
       return Impl<T>::push(self, ::std::move(item));
     }
 
+    template <typename T, typename... Args>
+    static void
+    emplace(T &self, Args &&... args) {
+      return Impl<T>::emplace(self, ::std::forward<Args>(args)...);
+    }
+
     template <typename T>
     static typename Impl<T>::Item
     pop(T &self) {
       return Impl<T>::pop(self);
     }
 
+    template <typename T>
+    static void
+    pop_into(T &self, typename Impl<T>::Item &item) {
+      return Impl<T>::pop_into(self, item);
+    }
+
+    template <typename T>
+    static void
+    drop(T &self) {
+      return Impl<T>::drop(self);
+    }
+
+    template <typename T>
+    static void
+    clear(T &self) {
+      return Impl<T>::clear(self);
+    }
+
     template <typename T>
     constexpr static auto
     REQUIRE() -> ::std::void_t<
@@ -124,6 +195,12 @@ namespace traits {
         typename ::std::enable_if<::std::is_same<
             decltype(Impl<T>::push), decltype(push<T>)>::value>::type,
         typename ::std::enable_if<::std::is_same<
-            decltype(Impl<T>::pop), decltype(pop<T>)>::value>::type>;
+            decltype(Impl<T>::pop), decltype(pop<T>)>::value>::type,
+        typename ::std::enable_if<::std::is_same<
+            decltype(Impl<T>::pop_into), decltype(pop_into<T>)>::value>::type,
+        typename ::std::enable_if<::std::is_same<
+            decltype(Impl<T>::drop), decltype(drop<T>)>::value>::type,
+        typename ::std::enable_if<::std::is_same<
+            decltype(Impl<T>::clear), decltype(clear<T>)>::value>::type>;
   };
 }
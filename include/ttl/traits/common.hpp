@@ -17,4 +17,14 @@ namespace traits {
 
   template <typename T, typename Trait>
   using IMPLEMENTS = decltype(Trait::template REQUIRE<T>());
+
+  template <typename T>
+  ::std::uint64_t
+  fingerprint() {
+    ::std::uint64_t hash = 0xcbf29ce484222325u;
+    for (char const *p = __PRETTY_FUNCTION__; *p != '\0'; ++p)
+      hash = (hash ^ static_cast<unsigned char>(*p)) * 0x100000001b3u;
+    hash = (hash ^ sizeof(T)) * 0x100000001b3u;
+    return (hash ^ alignof(T)) * 0x100000001b3u;
+  }
 }
@@ -0,0 +1,25 @@
+namespace traits {
+  struct Serialize {
+    template <typename T, typename = void> struct Impl;
+
+    template <typename T>
+    static bool
+    write(int fd, T const &self) {
+      return Impl<T>::write(fd, self);
+    }
+
+    template <typename T>
+    static bool
+    read(int fd, T &self) {
+      return Impl<T>::read(fd, self);
+    }
+
+    template <typename T>
+    constexpr static auto
+    REQUIRE() -> ::std::void_t<
+        typename ::std::enable_if<::std::is_same<
+            decltype(Impl<T>::write), decltype(write<T>)>::value>::type,
+        typename ::std::enable_if<::std::is_same<
+            decltype(Impl<T>::read), decltype(read<T>)>::value>::type>;
+  };
+}
@@ -9,12 +9,195 @@ namespace traits {
       return Impl<T>::add(self, ::std::move(item));
     }
 
+    template <typename T, typename... Args>
+    static typename Impl<T>::Item *
+    construct(T &self, Args &&... args) {
+      return Impl<T>::construct(self, ::std::forward<Args>(args)...);
+    }
+
     template <typename T>
     static typename Impl<T>::Item
     remove(T &self, typename Impl<T>::Item *ptr) {
       return Impl<T>::remove(self, ptr);
     }
 
+    template <typename T>
+    static void
+    destroy(T &self, typename Impl<T>::Item *ptr) {
+      return Impl<T>::destroy(self, ptr);
+    }
+
+    template <typename T, typename F>
+    static void
+    add_n(T &self, typename Impl<T>::Item **ptrs, ::std::size_t n,
+          F &&make) {
+      batch_add(self, ptrs, n, make, 0);
+    }
+
+    template <typename T, typename F>
+    static void
+    remove_n(T &self, typename Impl<T>::Item **ptrs, ::std::size_t n,
+             F &&take) {
+      batch_remove(self, ptrs, n, take, 0);
+    }
+
+    template <typename T>
+    static void
+    destroy_n(T &self, typename Impl<T>::Item **ptrs, ::std::size_t n) {
+      batch_destroy(self, ptrs, n, 0);
+    }
+
+    template <typename T>
+    static auto
+    release_all(T &self) -> decltype(Impl<T>::release_all(self)) {
+      return Impl<T>::release_all(self);
+    }
+
+    template <typename T>
+    constexpr static bool
+    releases_all() {
+      return has_release_all<T>(0);
+    }
+
+    template <typename T>
+    static bool
+    shares(T const &self, T const &other) {
+      return same_storage(self, other, 0);
+    }
+
+    template <typename T>
+    constexpr static auto
+    REQUIRE() -> ::std::void_t<
+        typename ::std::enable_if<
+            not::std::is_copy_constructible<T>::value>::type,
+        typename ::std::enable_if<not::std::is_copy_assignable<T>::value>::type,
+        typename Impl<T>::Item,
+        typename ::std::enable_if<::std::is_same<
+            decltype(Impl<T>::add), decltype(add<T>)>::value>::type,
+        typename ::std::enable_if<::std::is_same<
+            decltype(Impl<T>::remove), decltype(remove<T>)>::value>::type,
+        typename ::std::enable_if<::std::is_same<
+            decltype(Impl<T>::destroy), decltype(destroy<T>)>::value>::type>;
+
+  private:
+    template <typename T>
+    static auto
+    same_storage(T const &self, T const &other, int)
+        -> decltype(Impl<T>::shares(self, other)) {
+      return Impl<T>::shares(self, other);
+    }
+
+    template <typename T>
+    static bool
+    same_storage(T const &self, T const &other, long) {
+      return &self == &other;
+    }
+
+    template <typename T, typename F>
+    static auto
+    batch_add(T &self, typename Impl<T>::Item **ptrs, ::std::size_t n,
+              F &make, int)
+        -> decltype(Impl<T>::add_n(self, ptrs, n, make)) {
+      return Impl<T>::add_n(self, ptrs, n, make);
+    }
+
+    template <typename T, typename F>
+    static void
+    batch_add(T &self, typename Impl<T>::Item **ptrs, ::std::size_t n,
+              F &make, long) {
+      for (::std::size_t i = 0; i < n; ++i)
+        ptrs[i] = Impl<T>::add(self, make(i));
+    }
+
+    template <typename T, typename F>
+    static auto
+    batch_remove(T &self, typename Impl<T>::Item **ptrs, ::std::size_t n,
+                 F &take, int)
+        -> decltype(Impl<T>::remove_n(self, ptrs, n, take)) {
+      return Impl<T>::remove_n(self, ptrs, n, take);
+    }
+
+    template <typename T, typename F>
+    static void
+    batch_remove(T &self, typename Impl<T>::Item **ptrs, ::std::size_t n,
+                 F &take, long) {
+      for (::std::size_t i = 0; i < n; ++i)
+        take(i, Impl<T>::remove(self, ptrs[i]));
+    }
+
+    template <typename T>
+    static auto
+    batch_destroy(T &self, typename Impl<T>::Item **ptrs, ::std::size_t n,
+                  int) -> decltype(Impl<T>::destroy_n(self, ptrs, n)) {
+      return Impl<T>::destroy_n(self, ptrs, n);
+    }
+
+    template <typename T>
+    static void
+    batch_destroy(T &self, typename Impl<T>::Item **ptrs, ::std::size_t n,
+                  long) {
+      for (::std::size_t i = 0; i < n; ++i)
+        Impl<T>::destroy(self, ptrs[i]);
+    }
+
+    template <typename T>
+    constexpr static auto
+    has_release_all(int) -> decltype(&Impl<T>::release_all, bool()) {
+      return true;
+    }
+
+    template <typename T>
+    constexpr static bool
+    has_release_all(long) {
+      return false;
+    }
+  };
+
+  struct IndexAllocator {
+    template <typename T, typename = void> struct Impl;
+
+    template <typename T>
+    static ::std::uint32_t
+    add(T &self, typename Impl<T>::Item &&item) {
+      return Impl<T>::add(self, ::std::move(item));
+    }
+
+    template <typename T, typename... Args>
+    static ::std::uint32_t
+    construct(T &self, Args &&... args) {
+      return Impl<T>::construct(self, ::std::forward<Args>(args)...);
+    }
+
+    template <typename T>
+    static typename Impl<T>::Item
+    remove(T &self, ::std::uint32_t index) {
+      return Impl<T>::remove(self, index);
+    }
+
+    template <typename T>
+    static void
+    destroy(T &self, ::std::uint32_t index) {
+      return Impl<T>::destroy(self, index);
+    }
+
+    template <typename T>
+    static typename Impl<T>::Item &
+    get(T &self, ::std::uint32_t index) {
+      return Impl<T>::get(self, index);
+    }
+
+    template <typename T>
+    static auto
+    release_all(T &self) -> decltype(Impl<T>::release_all(self)) {
+      return Impl<T>::release_all(self);
+    }
+
+    template <typename T>
+    constexpr static bool
+    releases_all() {
+      return has_release_all<T>(0);
+    }
+
     template <typename T>
     constexpr static auto
     REQUIRE() -> ::std::void_t<
@@ -25,7 +208,39 @@ namespace traits {
         typename ::std::enable_if<::std::is_same<
             decltype(Impl<T>::add), decltype(add<T>)>::value>::type,
         typename ::std::enable_if<::std::is_same<
-            decltype(Impl<T>::remove), decltype(remove<T>)>::value>::type>;
+            decltype(Impl<T>::remove), decltype(remove<T>)>::value>::type,
+        typename ::std::enable_if<::std::is_same<
+            decltype(Impl<T>::destroy), decltype(destroy<T>)>::value>::type,
+        typename ::std::enable_if<::std::is_same<
+            decltype(Impl<T>::get), decltype(get<T>)>::value>::type>;
+
+  private:
+    template <typename T>
+    constexpr static auto
+    has_release_all(int) -> decltype(&Impl<T>::release_all, bool()) {
+      return true;
+    }
+
+    template <typename T>
+    constexpr static bool
+    has_release_all(long) {
+      return false;
+    }
+  };
+
+  struct Instrumentation {
+    template <typename T, typename = void> struct Impl;
+
+    template <typename T>
+    static void *
+    resize(T &self, void *ptr, ::std::size_t size, ::std::size_t new_size) {
+      return Impl<T>::resize(self, ptr, size, new_size);
+    }
+
+    template <typename T>
+    constexpr static auto
+    REQUIRE() -> ::std::void_t<typename ::std::enable_if<::std::is_same<
+        decltype(Impl<T>::resize), decltype(resize<T>)>::value>::type>;
   };
 
   struct Bounded {
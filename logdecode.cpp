@@ -0,0 +1,18 @@
+#include <ttl.hpp>
+
+int
+main(int argc, char *argv[]) {
+  FILE *in = (argc > 1) ? fopen(argv[1], "rb") : stdin;
+  if (in == nullptr) {
+    perror(argv[1]);
+    return 1;
+  }
+
+  bool ok = ::ttl::logging::decode_file(in, stdout);
+  if (in != stdin)
+    fclose(in);
+  if (!ok) {
+    fprintf(stderr, "malformed log file\n");
+    return 1;
+  }
+}
@@ -2,7 +2,7 @@
 #include <ttl.hpp>
 
 int
-main() {
-  if (!::ttl::test::run_tests())
+main(int argc, char *argv[]) {
+  if (!::ttl::test::run_tests(argc, argv))
     return 1;
 }